@@ -0,0 +1,81 @@
+// clock_gettime is outside strict C99
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+
+/*
+ * Reader throughput: the same source read by the mpc grammar plus
+ * lval_read, and by lread_all, reported in MB/s of source; lval_read's
+ * share of the first is shown on its own.
+ */
+
+static const char *sample =
+	"; a definition with the usual mix of tokens\n"
+	"(fun {fib-%d n} {\n"
+	"  if (< n 2) {n} {+ (fib-%d (- n 1)) (fib-%d (- n 2))}})\n"
+	"(def {table-%d} {1 -2 3.25 \"four\\n\" {five 6} (seven)})\n";
+
+static double
+now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int
+main(int argc, char **argv) {
+	size_t target = (argc > 1 ? atof(argv[1]) : 0.25) * (1 << 20);
+	size_t cap = target + 1024, len = 0;
+	char *src = malloc(cap);
+	for (int i = 0; len < target; i++) {
+		len += snprintf(src + len, cap - len, sample, i, i, i, i);
+	}
+	double mb = len / (1024.0 * 1024.0);
+	lparse_init();
+
+	double t = now();
+	mpc_result_t r;
+	if (!mpc_parse("bench", src, Lispy, &r)) {
+		mpc_err_print(r.error);
+		return 1;
+	}
+	double parse = now() - t;
+
+	// the reader is fast enough that one pass is mostly noise
+	int passes = 20;
+	lval *x;
+	t = now();
+	for (int i = 0; i < passes; i++) {
+		x = lval_read(r.output);
+		lval_del(x);
+	}
+	double convert = (now() - t) / passes;
+	mpc_ast_delete(r.output);
+	double mpc = parse + convert;
+
+	t = now();
+	for (int i = 0; i < passes; i++) {
+		x = lread_all("bench", src, len);
+		if (x->type == LVAL_ERR) {
+			printf("%s", x->val.err);
+			return 1;
+		}
+		lval_del(x);
+	}
+	double reader = (now() - t) / passes;
+
+	printf("%.2f MB of source\n", mb);
+	printf("mpc + lval_read: %8.2f MB/s\n", mb / mpc);
+	printf("  lval_read:     %8.2f MB/s\n", mb / convert);
+	printf("lread_all:       %8.2f MB/s\n", mb / reader);
+
+	lparse_cleanup();
+	free(src);
+	return 0;
+}
@@ -0,0 +1,837 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+const int lop_operands[OP_COUNT] = {
+	1, 1, 2, 1, 1, 3, 3, 4, 2, 2, 4, 2, 1, 0, 0,
+	7, 7, 7, 7, 2
+};
+
+// global scope of the code being compiled, which inlining consults
+static lenv *lcompile_globals;
+
+// scratch cell for the S-expression about to be compiled, or -1; taken
+// by lcompile_sexpr so it applies to that form and not its operands
+static int lcompile_dest = -1;
+// lowest scratch cell not holding an operand that is yet to be consumed
+static int lcompile_floor;
+// set while compiling the fallback of a folded site
+static int lcompile_nofold;
+
+static char *arith_names[ARITH_COUNT] = {
+	"+", "-", "*", "/", "%", ">", "<", ">=", "<=", "==", "!="
+};
+
+static lchunk *
+lchunk_new(void) {
+	lchunk *c = malloc(sizeof(*c));
+	c->refs = 1;
+	c->lambda = 0;
+	c->loop = 0;
+	c->nformals = 0;
+	c->variadic = 0;
+	c->nlocals = 0;
+	c->locals = NULL;
+	c->count = 0;
+	c->cap = 0;
+	c->code = NULL;
+	c->exec = NULL;
+	c->nconsts = 0;
+	c->consts = NULL;
+	c->ncaches = 0;
+	c->caches = NULL;
+	c->nscratch = 0;
+	c->calls = 0;
+	c->jit = NULL;
+	return c;
+}
+
+lchunk *
+lchunk_retain(lchunk *c) {
+	if (c) { c->refs++; }
+	return c;
+}
+
+void
+lchunk_release(lchunk *c) {
+	if (!c || --c->refs > 0) { return; }
+
+	for (int i = 0; i < c->nconsts; i++) {
+		lval_del(c->consts[i]);
+	}
+	free(c->consts);
+	free(c->caches);
+	ljit_release(c->jit);
+	free(c->locals);
+	free(c->code);
+	free(c->exec);
+	free(c);
+}
+
+static int
+lchunk_emit(lchunk *c, int word) {
+	if (c->count == c->cap) {
+		c->cap = c->cap ? c->cap * 2 : 32;
+		c->code = realloc(c->code, sizeof(int) * c->cap);
+	}
+	c->code[c->count] = word;
+	return c->count++;
+}
+
+// takes ownership of v
+static int
+lchunk_const(lchunk *c, lval *v) {
+	c->nconsts++;
+	c->consts = realloc(c->consts, sizeof(lval *) * c->nconsts);
+	c->consts[c->nconsts - 1] = v;
+	return c->nconsts - 1;
+}
+
+static int
+lchunk_cache(lchunk *c) {
+	c->ncaches++;
+	c->caches = realloc(c->caches, sizeof(lcache) * c->ncaches);
+	c->caches[c->ncaches - 1].env = NULL;
+	c->caches[c->ncaches - 1].slot = 0;
+	return c->ncaches - 1;
+}
+
+int
+lchunk_local(lchunk *c, char *sym) {
+	for (int i = 0; i < c->nlocals; i++) {
+		if (c->locals[i] == sym) { return i; }
+	}
+	return -1;
+}
+
+int
+lcompile_arith(char *sym) {
+	for (int i = 0; i < ARITH_COUNT; i++) {
+		if (strcmp(arith_names[i], sym) == 0) { return i; }
+	}
+	return -1;
+}
+
+static void lcompile(lchunk *, lval *, int);
+static void lcompile_sexpr(lchunk *, lval *, int);
+
+// operands of a binary arithmetic form a superinstruction can take
+typedef struct lfuse {
+	int op;
+	int arith;
+	int x;
+	int y;
+	int sym;
+	int cache;
+} lfuse;
+
+static int
+lcompile_fuse(lchunk *c, lval *v, lfuse *u) {
+	if (v->type != LVAL_SEXPR || v->count != 3) { return 0; }
+
+	lval *head = v->cells[0];
+	if (head->type != LVAL_SYM || lchunk_local(c, head->val.sym) >= 0) {
+		return 0;
+	}
+	if ((u->arith = lcompile_arith(head->val.sym)) < 0) { return 0; }
+
+	// the left operand must be a local, the right a local or an integer
+	lval *x = v->cells[1], *y = v->cells[2];
+	if (x->type != LVAL_SYM || (u->x = lchunk_local(c, x->val.sym)) < 0) {
+		return 0;
+	}
+	if (y->type == LVAL_SYM && (u->y = lchunk_local(c, y->val.sym)) >= 0) {
+		u->op = OP_ARITH_LL;
+	} else if (y->type == LVAL_NUM) {
+		u->op = OP_ARITH_LK;
+		u->y = lchunk_const(c, lval_copy(y));
+	} else {
+		return 0;
+	}
+
+	u->sym = lchunk_const(c, lval_copy(head));
+	u->cache = lchunk_cache(c);
+	return 1;
+}
+
+static void
+lcompile_fused_operands(lchunk *c, lfuse *u) {
+	lchunk_emit(c, u->arith);
+	lchunk_emit(c, u->x);
+	lchunk_emit(c, u->y);
+	lchunk_emit(c, u->sym);
+	lchunk_emit(c, u->cache);
+}
+
+// the unfused sequence a superinstruction falls back to
+static void
+lcompile_unfused(lchunk *c, lfuse *u) {
+	lchunk_emit(c, OP_LOCAL);
+	lchunk_emit(c, u->x);
+	lchunk_emit(c, u->op == OP_ARITH_LL ? OP_LOCAL : OP_CONST);
+	lchunk_emit(c, u->y);
+	lchunk_emit(c, OP_ARITH);
+	lchunk_emit(c, u->arith);
+	lchunk_emit(c, u->sym);
+	lchunk_emit(c, u->cache);
+	lchunk_emit(c, -1);
+}
+
+// whether v is a Q-expression of symbols, none of them a special form
+static int
+lcompile_symbols(lval *v) {
+	if (v->type != LVAL_QEXPR) { return 0; }
+	for (int i = 0; i < v->count; i++) {
+		if (v->cells[i]->type != LVAL_SYM || lsym_special(v->cells[i]->val.sym)) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Calls to small global lambdas whose bodies only apply builtins are
+ * inlined by substituting the arguments for the formals. Literals and
+ * locals can be substituted anywhere; one argument that needs evaluating
+ * may be too, if its formal is used exactly once, not in a branch, and
+ * is reached before the body applies anything, and if nothing in it is
+ * inlined or folded in turn. It is then still evaluated exactly once, and
+ * ahead of any application in the body that could fail, so errors come
+ * in the order the call would give them. Guards on the
+ * stamps of the callee and of the builtins its body applies fall back to
+ * the call once any of them is rebound, or shadowed by a local.
+ */
+
+#define LINLINE_NODES 16
+
+// builtins an inlined body may apply; none of them looks at its scope
+static lbuiltin linline_builtins[] = {
+	builtin_add, builtin_sub, builtin_mul, builtin_div, builtin_mod,
+	builtin_gt, builtin_lt, builtin_ge, builtin_le, builtin_eq, builtin_ne,
+	builtin_list, builtin_head, builtin_tail, builtin_join
+};
+
+typedef struct linliner {
+	lchunk *c;
+	lval *formals;
+	// uses of each formal, with branches counting as many
+	int uses[LINLINE_NODES];
+	int branch;
+	int nodes;
+	int ndeps;
+	char *deps[LINLINE_NODES + 1];
+} linliner;
+
+static int
+linline_formal(lval *formals, char *sym) {
+	for (int i = 0; i < formals->count; i++) {
+		if (formals->cells[i]->val.sym == sym) { return i; }
+	}
+	return -1;
+}
+
+static void
+linline_dep(linliner *n, char *sym) {
+	for (int i = 0; i < n->ndeps; i++) {
+		if (n->deps[i] == sym) { return; }
+	}
+	n->deps[n->ndeps++] = sym;
+}
+
+static int linline_cells(linliner *, lval *);
+
+static int
+linline_expr(linliner *n, lval *v) {
+	if (++n->nodes > LINLINE_NODES) { return 0; }
+	if (v->type == LVAL_SYM) {
+		int i = linline_formal(n->formals, v->val.sym);
+		if (i >= 0) { n->uses[i] += n->branch ? LINLINE_NODES : 1; }
+	}
+	return v->type != LVAL_SEXPR || linline_cells(n, v);
+}
+
+// whether the cells of v, evaluated as an S-expression, can be inlined
+static int
+linline_cells(linliner *n, lval *v) {
+	if (v->count == 0) { return 1; }
+	if (v->count == 1) { return linline_expr(n, v->cells[0]); }
+
+	lval *head = v->cells[0];
+	if (head->type != LVAL_SYM || linline_formal(n->formals, head->val.sym) >= 0 ||
+		lchunk_local(n->c, head->val.sym) >= 0) {
+		return 0;
+	}
+
+	// special forms cannot be rebound, so 'if' needs no guard
+	if (head->val.sym == lsym_intern("if", 2)) {
+		if (v->count != 4 || !linline_expr(n, v->cells[1]) ||
+			v->cells[2]->type != LVAL_QEXPR || v->cells[3]->type != LVAL_QEXPR) {
+			return 0;
+		}
+		n->branch++;
+		int ok = linline_cells(n, v->cells[2]) && linline_cells(n, v->cells[3]);
+		n->branch--;
+		return ok;
+	}
+
+	lval *f = lenv_find(lcompile_globals, head->val.sym);
+	int known = 0;
+	for (size_t i = 0; f && f->type == LVAL_FUN &&
+		i < sizeof(linline_builtins) / sizeof(linline_builtins[0]); i++) {
+		known = known || f->val.builtin == linline_builtins[i];
+	}
+	if (!known) { return 0; }
+	linline_dep(n, head->val.sym);
+
+	for (int i = 1; i < v->count; i++) {
+		if (!linline_expr(n, v->cells[i])) { return 0; }
+	}
+	return 1;
+}
+
+static int linline_leads_cells(lval *, char *);
+
+// 1 if evaluating v reaches sym before applying anything, -1 if it
+// applies something first, and 0 if it does neither
+static int
+linline_leads(lval *v, char *sym) {
+	if (v->type == LVAL_SYM) { return v->val.sym == sym; }
+	return v->type == LVAL_SEXPR ? linline_leads_cells(v, sym) : 0;
+}
+
+// linline_leads over the cells of v, evaluated as an S-expression; the
+// head of an application is a builtin, which is looked up without effect
+static int
+linline_leads_cells(lval *v, char *sym) {
+	if (v->count == 0) { return 0; }
+	if (v->count == 1) { return linline_leads(v->cells[0], sym); }
+	int is_if = v->cells[0]->type == LVAL_SYM &&
+		v->cells[0]->val.sym == lsym_intern("if", 2);
+	for (int i = 1; i < (is_if ? 2 : v->count); i++) {
+		int r = linline_leads(v->cells[i], sym);
+		if (r) { return r; }
+	}
+	return -1;
+}
+
+/*
+ * Whether compiling v could inline, fold or guard a call of its own. Such
+ * an argument is left to the call: linline compiles the argument in both
+ * of its paths, so nested ones would double the code at every level.
+ */
+static int
+linline_expands(lval *v) {
+	if (v->type != LVAL_SEXPR && v->type != LVAL_QEXPR) { return 0; }
+	if (v->count >= 2 && v->cells[0]->type == LVAL_SYM) {
+		lval *f = lenv_find(lcompile_globals, v->cells[0]->val.sym);
+		if (f && (f->type == LVAL_LAMBDA ||
+			(f->type == LVAL_FUN && f->val.builtin == builtin_loop))) {
+			return 1;
+		}
+		lopt_deps d = { 0, { NULL }, 0 };
+		lval *x = lopt_value(lcompile_globals, v, &d);
+		if (x) {
+			lval_del(x);
+			return 1;
+		}
+	}
+	for (int i = 0; i < v->count; i++) {
+		if (linline_expands(v->cells[i])) { return 1; }
+	}
+	return 0;
+}
+
+static lval *linline_subst_cells(lval *, lval *, lval *);
+
+// copy of v with the formals replaced by the arguments of call
+static lval *
+linline_subst(lval *v, lval *formals, lval *call) {
+	if (v->type == LVAL_SYM) {
+		int i = linline_formal(formals, v->val.sym);
+		return lval_copy(i >= 0 ? call->cells[i + 1] : v);
+	}
+	if (v->type != LVAL_SEXPR) { return lval_copy(v); }
+	return linline_subst_cells(v, formals, call);
+}
+
+// linline_subst over the cells of v, keeping its type
+static lval *
+linline_subst_cells(lval *v, lval *formals, lval *call) {
+	lval *x = v->type == LVAL_QEXPR ? lval_qexpr() : lval_sexpr();
+	int branches = v->count == 4 && v->cells[0]->type == LVAL_SYM &&
+		v->cells[0]->val.sym == lsym_intern("if", 2);
+	for (int i = 0; i < v->count; i++) {
+		lval *y = v->cells[i];
+		if (branches && i >= 2 && y->type == LVAL_QEXPR) {
+			lval_add(x, linline_subst_cells(y, formals, call));
+		} else {
+			lval_add(x, linline_subst(y, formals, call));
+		}
+	}
+	return x;
+}
+
+// stamp of the global binding of sym, or 0 if there is none
+static unsigned
+linline_version(char *sym) {
+	lenv *e = lcompile_globals;
+	for (int i = 0; e->vers && i < e->count; i++) {
+		if (e->syms[i] == sym) { return e->vers[i]; }
+	}
+	return 0;
+}
+
+static void lcompile_call(lchunk *, lval *, int, int);
+
+static int
+linline(lchunk *c, lval *v, int tail) {
+	if (!lcompile_globals) { return 0; }
+
+	char *sym = v->cells[0]->val.sym;
+	lval *g = lenv_find(lcompile_globals, sym);
+	if (!g || g->type != LVAL_LAMBDA || g->val.context->env->count) {
+		return 0;
+	}
+
+	lval *formals = g->val.context->formals;
+	if (formals->count != v->count - 1 || formals->count > LINLINE_NODES) {
+		return 0;
+	}
+	for (int i = 0; i < formals->count; i++) {
+		char *f = formals->cells[i]->val.sym;
+		if (strcmp(f, "&") == 0 || linline_formal(formals, f) != i) {
+			return 0;
+		}
+	}
+
+	linliner n = { c, formals, { 0 }, 0, 0, 0, { NULL } };
+	linline_dep(&n, sym);
+	if (!linline_cells(&n, g->val.context->body)) { return 0; }
+
+	int evaluated = 0;
+	for (int i = 1; i < v->count; i++) {
+		lval *a = v->cells[i];
+		if (a->type == LVAL_ERR) { return 0; }
+		if (a->type == LVAL_SEXPR ||
+			(a->type == LVAL_SYM && lchunk_local(c, a->val.sym) < 0)) {
+			if (evaluated++ || n.uses[i - 1] != 1 || linline_expands(a) ||
+				linline_leads_cells(g->val.context->body, formals->cells[i - 1]->val.sym) != 1) {
+				return 0;
+			}
+		}
+	}
+
+	int elses[LINLINE_NODES + 1];
+	for (int i = 0; i < n.ndeps; i++) {
+		lchunk_emit(c, OP_GUARD);
+		lchunk_emit(c, lchunk_const(c, lval_sym(n.deps[i])));
+		lchunk_emit(c, lchunk_cache(c));
+		lchunk_emit(c, (int) linline_version(n.deps[i]));
+		elses[i] = lchunk_emit(c, 0);
+	}
+
+	lval *x = linline_subst_cells(g->val.context->body, formals, v);
+	lcompile_sexpr(c, x, tail);
+	lval_del(x);
+	lchunk_emit(c, OP_JUMP);
+	int end = lchunk_emit(c, 0);
+
+	for (int i = 0; i < n.ndeps; i++) {
+		c->code[elses[i]] = c->count;
+	}
+	lcompile_call(c, v, tail, -1);
+	c->code[end] = c->count;
+	return 1;
+}
+
+static void
+lcompile_if(lchunk *c, lval *v, int tail) {
+	lfuse u;
+	int fused = lcompile_fuse(c, v->cells[1], &u);
+	int to_then = 0, fused_else = 0;
+
+	if (fused) {
+		lchunk_emit(c, u.op == OP_ARITH_LL ? OP_IF_LL : OP_IF_LK);
+		lcompile_fused_operands(c, &u);
+		to_then = lchunk_emit(c, 0);
+		fused_else = lchunk_emit(c, 0);
+		lcompile_unfused(c, &u);
+	} else {
+		// OP_IF only reads the condition
+		if (v->cells[1]->type == LVAL_SEXPR) { lcompile_dest = lcompile_floor; }
+		lcompile(c, v->cells[1], 0);
+	}
+
+	lchunk_emit(c, OP_IF);
+	int to_else = lchunk_emit(c, 0);
+	int to_end = lchunk_emit(c, 0);
+
+	// both branches are Q-expressions evaluated as S-expressions
+	if (fused) { c->code[to_then] = c->count; }
+	lcompile_sexpr(c, v->cells[2], tail);
+	lchunk_emit(c, OP_JUMP);
+	int skip = lchunk_emit(c, 0);
+
+	c->code[to_else] = c->count;
+	if (fused) { c->code[fused_else] = c->count; }
+	lcompile_sexpr(c, v->cells[3], tail);
+
+	c->code[to_end] = c->count;
+	c->code[skip] = c->count;
+}
+
+// emits a guard that jumps to the returned operand unless sym still names
+// the builtin b, or returns -1 if it does not name it now
+static int
+lcompile_builtin_guard(lchunk *c, char *sym, lbuiltin b) {
+	lval *f = lcompile_globals ? lenv_find(lcompile_globals, sym) : NULL;
+	unsigned v = f ? linline_version(sym) : 0;
+	if (!v || f->type != LVAL_FUN || f->val.builtin != b) { return -1; }
+	lchunk_emit(c, OP_GUARD);
+	lchunk_emit(c, lchunk_const(c, lval_sym(sym)));
+	lchunk_emit(c, lchunk_cache(c));
+	lchunk_emit(c, (int) v);
+	return lchunk_emit(c, 0);
+}
+
+/*
+ * Folds v when lopt_value can compute it, behind guards on the operators
+ * it applied. The fallback is compiled without folding, so nothing under
+ * a folded site is compiled twice; an 'if' that does not fold as a whole
+ * has its condition folded when lcompile_if compiles it. Operators that
+ * are locals here are never global, so those sites are left alone.
+ */
+static int
+lcompile_fold(lchunk *c, lval *v, int tail) {
+	if (!lcompile_globals || lcompile_nofold) { return 0; }
+
+	lopt_deps d = { 0, { NULL }, 0 };
+	lval *x = lopt_value(lcompile_globals, v, &d);
+	if (!x) { return 0; }
+
+	unsigned vers[LOPT_DEPS];
+	for (int i = 0; i < d.count; i++) {
+		vers[i] = linline_version(d.syms[i]);
+		if (!vers[i] || lchunk_local(c, d.syms[i]) >= 0) {
+			lval_del(x);
+			return 0;
+		}
+	}
+
+	if (lopt_dump) {
+		printf("; folded: ");
+		lval_print(v);
+		printf(" to ");
+		lval_println(x);
+	}
+
+	int elses[LOPT_DEPS];
+	for (int i = 0; i < d.count; i++) {
+		lchunk_emit(c, OP_GUARD);
+		lchunk_emit(c, lchunk_const(c, lval_sym(d.syms[i])));
+		lchunk_emit(c, lchunk_cache(c));
+		lchunk_emit(c, (int) vers[i]);
+		elses[i] = lchunk_emit(c, 0);
+	}
+	lchunk_emit(c, OP_CONST);
+	lchunk_emit(c, lchunk_const(c, x));
+	if (!d.count) { return 1; }
+	lchunk_emit(c, OP_JUMP);
+	int end = lchunk_emit(c, 0);
+
+	for (int i = 0; i < d.count; i++) {
+		c->code[elses[i]] = c->count;
+	}
+	lcompile_nofold = 1;
+	if (v->cells[0]->val.sym == lsym_intern("if", 2)) {
+		lcompile_if(c, v, tail);
+	} else {
+		lcompile_call(c, v, tail, -1);
+	}
+	lcompile_nofold = 0;
+	c->code[end] = c->count;
+	return 1;
+}
+
+/*
+ * A 'loop' with literal variables and body calls a lambda whose chunk is
+ * compiled here, and 'recur' in that chunk restarts it with OP_RECUR.
+ * Both are guarded like inlined calls, falling back to calling whatever
+ * the names are rebound to.
+ */
+static int
+lcompile_loop_form(lchunk *c, lval *v, int tail) {
+	char *sym = v->cells[0]->val.sym;
+	int loop = sym == lsym_intern("loop", 4) && v->count >= 3 &&
+		lcompile_symbols(v->cells[1]) && v->cells[2]->type == LVAL_QEXPR &&
+		v->cells[1]->count == v->count - 3;
+	int recur = sym == lsym_intern("recur", 5) && c->loop && !c->variadic &&
+		v->count - 1 == c->nformals;
+	if (!loop && !recur) { return 0; }
+
+	lval *f = NULL;
+	if (loop) {
+		f = lval_lambda(lval_copy(v->cells[1]), lval_copy(v->cells[2]));
+		f->val.context->chunk = lcompile_loop(lcompile_globals,
+			f->val.context->formals, f->val.context->body);
+		if (!f->val.context->chunk) {
+			lval_del(f);
+			return 0;
+		}
+	}
+
+	int to_else = lcompile_builtin_guard(c, sym, loop ? builtin_loop : builtin_recur);
+	if (to_else < 0) {
+		if (f) { lval_del(f); }
+		return 0;
+	}
+
+	if (loop) {
+		lchunk_emit(c, OP_CONST);
+		lchunk_emit(c, lchunk_const(c, f));
+	}
+	// OP_RECUR copies numbers out of scratch into the variables
+	int floor = lcompile_floor;
+	for (int i = loop ? 3 : 1; i < v->count; i++) {
+		if (recur) {
+			lcompile_floor = floor + i - 1;
+			if (v->cells[i]->type == LVAL_SEXPR) { lcompile_dest = lcompile_floor; }
+		}
+		lcompile(c, v->cells[i], 0);
+	}
+	lcompile_floor = floor;
+	if (loop) {
+		lchunk_emit(c, tail ? OP_TCALL : OP_CALL);
+		lchunk_emit(c, v->count - 3);
+	} else {
+		lchunk_emit(c, OP_RECUR);
+		lchunk_emit(c, v->count - 1);
+		lchunk_emit(c, tail);
+	}
+	lchunk_emit(c, OP_JUMP);
+	int end = lchunk_emit(c, 0);
+
+	c->code[to_else] = c->count;
+	lcompile_call(c, v, tail, -1);
+	c->code[end] = c->count;
+	return 1;
+}
+
+/*
+ * Compiles the cells of v as the evaluation of an S-expression. Calls in
+ * tail position let the VM reuse the frame for the callee.
+ */
+static void
+lcompile_sexpr(lchunk *c, lval *v, int tail) {
+	int dest = lcompile_dest;
+	lcompile_dest = -1;
+
+	// empty expression evaluates to itself
+	if (v->count == 0) {
+		lchunk_emit(c, OP_CONST);
+		lchunk_emit(c, lchunk_const(c, lval_sexpr()));
+		return;
+	}
+
+	// single expression evaluates to its only element
+	if (v->count == 1) {
+		lcompile(c, v->cells[0], tail);
+		return;
+	}
+
+	lval *head = v->cells[0];
+	if (head->type != LVAL_SYM || lchunk_local(c, head->val.sym) >= 0) {
+		for (int i = 0; i < v->count; i++) {
+			lcompile(c, v->cells[i], 0);
+		}
+		lchunk_emit(c, tail ? OP_TCALL : OP_CALL);
+		lchunk_emit(c, v->count - 1);
+		return;
+	}
+
+	if (lcompile_fold(c, v, tail)) { return; }
+
+	// 'if' with literal branches jumps instead of copying both branches
+	if (head->val.sym == lsym_intern("if", 2) && v->count == 4 &&
+		v->cells[2]->type == LVAL_QEXPR && v->cells[3]->type == LVAL_QEXPR) {
+		lcompile_if(c, v, tail);
+		return;
+	}
+
+	// '\' with literal formals and body is a constant; its copies share
+	// one chunk, compiled here
+	if (head->val.sym == lsym_intern("\\", 1) && v->count == 3 &&
+		lcompile_symbols(v->cells[1]) && v->cells[2]->type == LVAL_QEXPR) {
+		lval *f = lval_lambda(lval_copy(v->cells[1]), lval_copy(v->cells[2]));
+		f->val.context->chunk = lcompile_lambda(lcompile_globals,
+			f->val.context->formals, f->val.context->body);
+		lchunk_emit(c, OP_CONST);
+		lchunk_emit(c, lchunk_const(c, f));
+		return;
+	}
+
+	// 'def' and '=' with a literal symbol list bind the values directly
+	int def = head->val.sym == lsym_intern("def", 3);
+	if ((def || head->val.sym == lsym_intern("=", 1)) &&
+		lcompile_symbols(v->cells[1]) && v->cells[1]->count == v->count - 2) {
+		for (int i = 2; i < v->count; i++) {
+			lcompile(c, v->cells[i], 0);
+		}
+		lchunk_emit(c, def ? OP_DEF : OP_PUT);
+		lchunk_emit(c, lchunk_const(c, lval_copy(v->cells[1])));
+		lchunk_emit(c, v->count - 2);
+		return;
+	}
+
+	if (linline(c, v, tail) || lcompile_loop_form(c, v, tail)) { return; }
+	lcompile_call(c, v, tail, dest);
+}
+
+/*
+ * Compiles the application of the global function head names. When it
+ * is inline arithmetic, dest is the scratch cell its result may be left
+ * in, or -1; the operands of the operation itself get cells from dest on,
+ * the left one the cell the result reuses.
+ */
+static void
+lcompile_call(lchunk *c, lval *v, int tail, int dest) {
+	lval *head = v->cells[0];
+	lfuse u;
+	if (lcompile_fuse(c, v, &u)) {
+		lchunk_emit(c, u.op);
+		lcompile_fused_operands(c, &u);
+		int next = lchunk_emit(c, 0);
+		lchunk_emit(c, dest);
+		if (dest >= c->nscratch) { c->nscratch = dest + 1; }
+		lcompile_unfused(c, &u);
+		c->code[next] = c->count;
+		return;
+	}
+
+	int arith = v->count == 3 ? lcompile_arith(head->val.sym) : -1;
+	int floor = lcompile_floor;
+	int base = dest >= 0 ? dest : floor;
+	for (int i = 1; i < v->count; i++) {
+		if (arith >= 0) {
+			lcompile_floor = base + i - 1;
+			if (v->cells[i]->type == LVAL_SEXPR) { lcompile_dest = lcompile_floor; }
+		}
+		lcompile(c, v->cells[i], 0);
+	}
+	lcompile_floor = floor;
+
+	if (arith >= 0) {
+		lchunk_emit(c, OP_ARITH);
+		lchunk_emit(c, arith);
+	} else {
+		lchunk_emit(c, tail ? OP_TCALLSYM : OP_CALLSYM);
+	}
+	lchunk_emit(c, lchunk_const(c, lval_copy(head)));
+	lchunk_emit(c, lchunk_cache(c));
+	lchunk_emit(c, arith >= 0 ? dest : v->count - 1);
+}
+
+static void
+lcompile(lchunk *c, lval *v, int tail) {
+	switch (v->type) {
+		case LVAL_SYM: {
+			int i = lchunk_local(c, v->val.sym);
+			if (i >= 0) {
+				lchunk_emit(c, OP_LOCAL);
+				lchunk_emit(c, i);
+			} else {
+				lchunk_emit(c, OP_LOOKUP);
+				lchunk_emit(c, lchunk_const(c, lval_copy(v)));
+				lchunk_emit(c, lchunk_cache(c));
+			}
+			return;
+		}
+		case LVAL_SEXPR:
+			lcompile_sexpr(c, v, tail);
+			return;
+		default:
+			// everything else, Q-expressions included, evaluates to itself
+			lchunk_emit(c, OP_CONST);
+			lchunk_emit(c, lchunk_const(c, lval_copy(v)));
+			return;
+	}
+}
+
+static lenv *
+lcompile_enter(lenv *e) {
+	lopt_forget();
+	lenv *saved = lcompile_globals;
+	while (e && e->par) { e = e->par; }
+	lcompile_globals = e;
+	return saved;
+}
+
+static lchunk *
+lcompile_body(lenv *e, lval *formals, lval *body, int loop) {
+	lchunk *c = lchunk_new();
+	c->lambda = 1;
+	c->loop = loop;
+	c->locals = malloc(sizeof(char *) * (formals->count + 1));
+
+	for (int i = 0; i < formals->count; i++) {
+		char *sym = formals->cells[i]->val.sym;
+
+		// '&' must be followed by exactly one symbol; leave anything
+		// else, and repeated formals, to the tree-walker to report
+		if (strcmp(sym, "&") == 0) {
+			if (i != formals->count - 2 ||
+				strcmp(formals->cells[i + 1]->val.sym, "&") == 0) {
+				lchunk_release(c);
+				return NULL;
+			}
+			c->variadic = 1;
+			continue;
+		}
+		if (lchunk_local(c, sym) >= 0) {
+			lchunk_release(c);
+			return NULL;
+		}
+		c->locals[c->nlocals++] = sym;
+	}
+	c->nformals = c->nlocals - c->variadic;
+
+	lenv *saved = lcompile_enter(e);
+	int floor = lcompile_floor, nofold = lcompile_nofold;
+	lcompile_floor = 0;
+	lcompile_nofold = 0;
+	lcompile_sexpr(c, body, 1);
+	lcompile_floor = floor;
+	lcompile_nofold = nofold;
+	lcompile_globals = saved;
+	lchunk_emit(c, OP_RETURN);
+	lvm_thread(c);
+	return c;
+}
+
+lchunk *
+lcompile_lambda(lenv *e, lval *formals, lval *body) {
+	return lcompile_body(e, formals, body, 0);
+}
+
+lchunk *
+lcompile_loop(lenv *e, lval *formals, lval *body) {
+	return lcompile_body(e, formals, body, 1);
+}
+
+lchunk *
+lcompile_expr(lenv *e, lval *v) {
+	lchunk *c = lchunk_new();
+	lenv *saved = lcompile_enter(e);
+	int floor = lcompile_floor;
+	lcompile_floor = 0;
+	lcompile(c, v, 1);
+	lcompile_floor = floor;
+	lcompile_globals = saved;
+	lchunk_emit(c, OP_RETURN);
+	lvm_thread(c);
+	return c;
+}
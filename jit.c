@@ -0,0 +1,702 @@
+// mmap flags such as MAP_ANONYMOUS are outside strict C99
+#define _DEFAULT_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+int ljit_stats = 0;
+
+#if defined(LISPY_JIT) && defined(__x86_64__) && defined(__linux__)
+#define LJIT_NATIVE 1
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/*
+ * Baseline template JIT for x86-64. A lambda whose reachable bytecode
+ * only does integer arithmetic on its formals and literals, branches and
+ * calls itself is translated op by op into native code once it has been
+ * called LJIT_THRESHOLD times. Values stay unboxed on the machine stack.
+ *
+ * On entry the native code is only used if every argument is an integer
+ * and every global it relies on still has the stamp it had when compiled.
+ * It bails out on anything it does not handle -- overflow, division by
+ * zero, recursion deeper than LJIT_DEPTH -- and since such lambdas have
+ * no side effects, the interpreter then runs the call again from scratch.
+ *
+ * lispyc translates the same subset to C ahead of time. Its functions are
+ * adopted here once the program defines their lambdas, and run under the
+ * same checks; that part works with or without the JIT itself.
+ */
+
+#define LJIT_THRESHOLD 50
+// code that keeps bailing out is given up on, rather than rerun each time
+#define LJIT_BAILS 8
+
+// a global the native code assumes is still bound as when compiled
+typedef struct ljit_check {
+	char *sym;
+	unsigned stamp;
+	lcache cache;
+} ljit_check;
+
+struct ljit {
+	ljit_fn fn;
+	size_t mapped;
+	int nchecks;
+	ljit_check *checks;
+	int bails;
+};
+
+long ljit_depth;
+
+// what has been compiled, for --jit-stats
+typedef struct ljit_record {
+	char *name;
+	int words;
+	int bytes;
+} ljit_record;
+
+static ljit_record *ljit_records;
+static int ljit_count;
+
+/* Analysis */
+
+typedef struct ljit_unit {
+	lchunk *c;
+	lenv *globals;
+	int nchecks;
+	ljit_check *checks;
+} ljit_unit;
+
+// stamp and value of the global binding of sym
+static lval *
+ljit_global(lenv *e, char *sym, unsigned *stamp) {
+	for (int i = 0; i < e->count; i++) {
+		if (e->syms[i] == sym) {
+			*stamp = e->vers ? e->vers[i] : 0;
+			return e->vals[i];
+		}
+	}
+	return NULL;
+}
+
+static void
+ljit_require(ljit_unit *u, char *sym, unsigned stamp) {
+	for (int i = 0; i < u->nchecks; i++) {
+		if (u->checks[i].sym == sym) { return; }
+	}
+	u->nchecks++;
+	u->checks = realloc(u->checks, sizeof(ljit_check) * u->nchecks);
+	ljit_check *k = &u->checks[u->nchecks - 1];
+	k->sym = sym;
+	k->stamp = stamp;
+	k->cache.env = NULL;
+	k->cache.slot = 0;
+}
+
+// whether consts[k] names the builtin for arith, requiring that it stays so
+static int
+ljit_operator(ljit_unit *u, int arith, int k) {
+	unsigned stamp;
+	char *sym = u->c->consts[k]->val.sym;
+	lval *f = ljit_global(u->globals, sym, &stamp);
+	if (!f || !stamp || f->type != LVAL_FUN || f->val.builtin != arith_builtins[arith]) {
+		return 0;
+	}
+	ljit_require(u, sym, stamp);
+	return 1;
+}
+
+// whether consts[k] names the lambda being compiled
+static int
+ljit_self(ljit_unit *u, int k, int argc) {
+	unsigned stamp;
+	char *sym = u->c->consts[k]->val.sym;
+	lval *f = ljit_global(u->globals, sym, &stamp);
+	if (!f || !stamp || f->type != LVAL_LAMBDA || f->val.context->chunk != u->c ||
+		f->val.context->memo || argc != u->c->nformals) {
+		return 0;
+	}
+	ljit_require(u, sym, stamp);
+	return 1;
+}
+
+static int
+ljit_guard(ljit_unit *u, int k, int version) {
+	unsigned stamp;
+	char *sym = u->c->consts[k]->val.sym;
+	if (!ljit_global(u->globals, sym, &stamp) || stamp != (unsigned) version) {
+		return 0;
+	}
+	ljit_require(u, sym, stamp);
+	return 1;
+}
+
+/*
+ * Marks the code reachable once the entry checks pass: guards hold and
+ * fused instructions never fall back to their unfused sequence. Returns
+ * 0 if anything reachable cannot be translated.
+ */
+static int
+ljit_reach(ljit_unit *u, char *reach) {
+	lchunk *c = u->c;
+	int *work = malloc(sizeof(int) * (c->count + 1));
+	int n = 0;
+	work[n++] = 0;
+	reach[0] = 1;
+
+	while (n) {
+		int pc = work[--n];
+
+		int *op = &c->code[pc + 1];
+		int next = pc + 1 + lop_operands[c->code[pc]];
+		int to[2], nto = 0;
+
+		switch (c->code[pc]) {
+			case OP_CONST:
+				if (c->consts[op[0]]->type != LVAL_NUM) { goto fail; }
+				to[nto++] = next;
+				break;
+			case OP_LOCAL:
+			case OP_POP:
+				to[nto++] = next;
+				break;
+			case OP_ARITH:
+				if (!ljit_operator(u, op[0], op[1])) { goto fail; }
+				to[nto++] = next;
+				break;
+			case OP_GUARD:
+				if (!ljit_guard(u, op[0], op[2])) { goto fail; }
+				to[nto++] = next;
+				break;
+			case OP_ARITH_LL:
+			case OP_ARITH_LK:
+				if (!ljit_operator(u, op[0], op[3])) { goto fail; }
+				to[nto++] = op[5];
+				break;
+			case OP_IF_LL:
+			case OP_IF_LK:
+				if (!ljit_operator(u, op[0], op[3])) { goto fail; }
+				to[nto++] = op[5];
+				to[nto++] = op[6];
+				break;
+			case OP_IF:
+				to[nto++] = next;
+				to[nto++] = op[0];
+				break;
+			case OP_JUMP:
+				to[nto++] = op[0];
+				break;
+			case OP_RETURN:
+				break;
+			case OP_CALLSYM:
+				if (!ljit_self(u, op[0], op[2])) { goto fail; }
+				to[nto++] = next;
+				break;
+			case OP_TCALLSYM:
+				if (!ljit_self(u, op[0], op[2])) { goto fail; }
+				break;
+			case OP_RECUR:
+				if (!op[1]) { to[nto++] = next; }
+				break;
+			default:
+				goto fail;
+		}
+		for (int i = 0; i < nto; i++) {
+			if (!reach[to[i]]) {
+				reach[to[i]] = 1;
+				work[n++] = to[i];
+			}
+		}
+	}
+	free(work);
+	return 1;
+
+fail:
+	free(work);
+	return 0;
+}
+
+/*
+ * Marks in reach the code of c that native code for it would run, for
+ * lispyc, or returns 0 if it cannot be translated. c runs in the global
+ * environment e.
+ */
+int
+ljit_plan(lenv *e, lchunk *c, char *reach) {
+	if (!c->lambda || c->variadic) { return 0; }
+	ljit_unit u = { c, e, 0, NULL };
+	int ok = ljit_reach(&u, reach);
+	free(u.checks);
+	return ok;
+}
+
+static ljit *
+ljit_new(ljit_fn fn, size_t mapped, ljit_unit *u) {
+	ljit *j = malloc(sizeof(*j));
+	j->fn = fn;
+	j->mapped = mapped;
+	j->nchecks = u->nchecks;
+	j->checks = u->checks;
+	j->bails = 0;
+	return j;
+}
+
+#ifdef LJIT_NATIVE
+
+// name of a global bound to a lambda running c, for the report
+static char *
+ljit_name(lenv *e, lchunk *c) {
+	for (int i = 0; i < e->count; i++) {
+		lval *v = e->vals[i];
+		if (v->type == LVAL_LAMBDA && v->val.context->chunk == c) {
+			return e->syms[i];
+		}
+	}
+	return "lambda";
+}
+
+/* Assembler */
+
+// jump targets besides bytecode offsets
+enum { LJIT_ENTRY = -1, LJIT_BODY = -2, LJIT_OK = -3, LJIT_BAIL = -4,
+	LJIT_BAIL_NODEC = -5, LJIT_LABELS = 5 };
+
+typedef struct lasm {
+	unsigned char *buf;
+	int len;
+	int cap;
+	int *labels;
+	int special[LJIT_LABELS];
+	int npatches;
+	int *patch_at;
+	int *patch_to;
+} lasm;
+
+static void
+lasm_bytes(lasm *a, const char *bytes, int n) {
+	if (a->len + n > a->cap) {
+		a->cap = (a->len + n) * 2;
+		a->buf = realloc(a->buf, a->cap);
+	}
+	memcpy(a->buf + a->len, bytes, n);
+	a->len += n;
+}
+
+static void
+lasm_i32(lasm *a, int32_t x) {
+	lasm_bytes(a, (char *) &x, 4);
+}
+
+static void
+lasm_i64(lasm *a, int64_t x) {
+	lasm_bytes(a, (char *) &x, 8);
+}
+
+static int *
+lasm_label(lasm *a, int to) {
+	return to >= 0 ? &a->labels[to] : &a->special[-to - 1];
+}
+
+static void
+lasm_mark(lasm *a, int to) {
+	*lasm_label(a, to) = a->len;
+}
+
+// emits a jump opcode with a rel32 to be resolved once labels are known
+static void
+lasm_jump(lasm *a, const char *op, int n, int to) {
+	lasm_bytes(a, op, n);
+	a->npatches++;
+	a->patch_at = realloc(a->patch_at, sizeof(int) * a->npatches);
+	a->patch_to = realloc(a->patch_to, sizeof(int) * a->npatches);
+	a->patch_at[a->npatches - 1] = a->len;
+	a->patch_to[a->npatches - 1] = to;
+	lasm_i32(a, 0);
+}
+
+#define JMP(a, to) lasm_jump(a, "\xE9", 1, to)
+#define JZ(a, to)  lasm_jump(a, "\x0F\x84", 2, to)
+#define JNZ(a, to) lasm_jump(a, "\x0F\x85", 2, to)
+#define JO(a, to)  lasm_jump(a, "\x0F\x80", 2, to)
+#define JAE(a, to) lasm_jump(a, "\x0F\x83", 2, to)
+
+// rax <- local i, which lives at rbx - 8i
+static void
+lasm_local(lasm *a, const char *op, int i) {
+	lasm_bytes(a, op, 3);
+	lasm_i32(a, -8 * i);
+}
+
+#define LOAD_RAX(a, i) lasm_local(a, "\x48\x8B\x83", i)
+#define LOAD_RCX(a, i) lasm_local(a, "\x48\x8B\x8B", i)
+#define STORE_RAX(a, i) lasm_local(a, "\x48\x89\x83", i)
+
+static void
+lasm_epilogue(lasm *a) {
+	// lea rsp, [rbp-16]; pop r12; pop rbx; pop rbp; ret
+	lasm_bytes(a, "\x48\x8D\x65\xF0\x41\x5C\x5B\x5D\xC3", 9);
+}
+
+// rax <- rax op rcx
+static void
+lasm_arith(lasm *a, int op) {
+	static const char setcc[ARITH_COUNT] = {
+		[ARITH_GT] = '\x9F', [ARITH_LT] = '\x9C', [ARITH_GE] = '\x9D',
+		[ARITH_LE] = '\x9E', [ARITH_EQ] = '\x94', [ARITH_NE] = '\x95'
+	};
+
+	switch (op) {
+		case ARITH_ADD:
+			lasm_bytes(a, "\x48\x01\xC8", 3);
+			JO(a, LJIT_BAIL);
+			return;
+		case ARITH_SUB:
+			lasm_bytes(a, "\x48\x29\xC8", 3);
+			JO(a, LJIT_BAIL);
+			return;
+		case ARITH_MUL:
+			lasm_bytes(a, "\x48\x0F\xAF\xC1", 4);
+			JO(a, LJIT_BAIL);
+			return;
+		case ARITH_DIV:
+		case ARITH_MOD:
+			// test rcx, rcx; cmp rcx, -1 -- leave both to the interpreter
+			lasm_bytes(a, "\x48\x85\xC9", 3);
+			JZ(a, LJIT_BAIL);
+			lasm_bytes(a, "\x48\x83\xF9\xFF", 4);
+			JZ(a, LJIT_BAIL);
+			// cqo; idiv rcx
+			lasm_bytes(a, "\x48\x99\x48\xF7\xF9", 5);
+			if (op == ARITH_MOD) { lasm_bytes(a, "\x48\x89\xD0", 3); }
+			return;
+		default:
+			// cmp rax, rcx
+			lasm_bytes(a, "\x48\x39\xC8", 3);
+			break;
+	}
+	// setcc al; movzx eax, al
+	char set[6] = { '\x0F', setcc[op], '\xC0', '\x0F', '\xB6', '\xC0' };
+	lasm_bytes(a, set, 6);
+}
+
+/* Translation */
+
+// a call of the lambda being compiled with the n values on top
+static void
+ljit_call(lasm *a, int n) {
+	// lea rdi, [rsp + 8(n-1)]; push rax as the result slot; mov rsi, rsp
+	lasm_bytes(a, "\x48\x8D\xBC\x24", 4);
+	lasm_i32(a, 8 * (n - 1));
+	lasm_bytes(a, "\x50\x48\x89\xE6", 4);
+	lasm_jump(a, "\xE8", 1, LJIT_ENTRY);
+	// test eax, eax; pop rax; add rsp, 8n; push rax
+	lasm_bytes(a, "\x85\xC0", 2);
+	JZ(a, LJIT_BAIL);
+	lasm_bytes(a, "\x58\x48\x81\xC4", 4);
+	lasm_i32(a, 8 * n);
+	lasm_bytes(a, "\x50", 1);
+}
+
+// the same call in tail position: the n values replace the locals, then
+// the body starts over
+static void
+ljit_tail(lasm *a, int n) {
+	for (int i = n - 1; i >= 0; i--) {
+		lasm_bytes(a, "\x58", 1);
+		STORE_RAX(a, i);
+	}
+	lasm_bytes(a, "\x48\x8D\x65\xF0", 4);
+	JMP(a, LJIT_BODY);
+}
+
+static void
+ljit_translate(lasm *a, lchunk *c, char *reach) {
+	// push rbp; mov rbp, rsp; push rbx; push r12; mov rbx, rdi; mov r12, rsi
+	lasm_mark(a, LJIT_ENTRY);
+	lasm_bytes(a, "\x55\x48\x89\xE5\x53\x41\x54\x48\x89\xFB\x49\x89\xF4", 13);
+
+	// bail out when nested too deep, otherwise count this activation
+	lasm_bytes(a, "\x48\xB8", 2);
+	lasm_i64(a, (int64_t) (intptr_t) &ljit_depth);
+	lasm_bytes(a, "\x48\x81\x38", 3);
+	lasm_i32(a, LJIT_DEPTH);
+	JAE(a, LJIT_BAIL_NODEC);
+	lasm_bytes(a, "\x48\xFF\x00", 3);
+	lasm_mark(a, LJIT_BODY);
+
+	for (int pc = 0; pc < c->count; pc += 1 + lop_operands[c->code[pc]]) {
+		if (!reach[pc]) { continue; }
+		lasm_mark(a, pc);
+		int *op = &c->code[pc + 1];
+
+		switch (c->code[pc]) {
+			case OP_CONST:
+				lasm_bytes(a, "\x48\xB8", 2);
+				lasm_i64(a, c->consts[op[0]]->val.num);
+				lasm_bytes(a, "\x50", 1);
+				break;
+			case OP_LOCAL:
+				// push qword [rbx - 8i]
+				lasm_bytes(a, "\xFF\xB3", 2);
+				lasm_i32(a, -8 * op[0]);
+				break;
+			case OP_POP:
+				lasm_bytes(a, "\x58", 1);
+				break;
+			case OP_ARITH:
+				lasm_bytes(a, "\x59\x58", 2);
+				lasm_arith(a, op[0]);
+				lasm_bytes(a, "\x50", 1);
+				break;
+			case OP_GUARD:
+				break;
+			case OP_ARITH_LL:
+			case OP_IF_LL:
+			case OP_ARITH_LK:
+			case OP_IF_LK:
+				LOAD_RAX(a, op[1]);
+				if (c->code[pc] == OP_ARITH_LL || c->code[pc] == OP_IF_LL) {
+					LOAD_RCX(a, op[2]);
+				} else {
+					lasm_bytes(a, "\x48\xB9", 2);
+					lasm_i64(a, c->consts[op[2]]->val.num);
+				}
+				lasm_arith(a, op[0]);
+				if (c->code[pc] == OP_ARITH_LL || c->code[pc] == OP_ARITH_LK) {
+					lasm_bytes(a, "\x50", 1);
+					JMP(a, op[5]);
+				} else {
+					lasm_bytes(a, "\x48\x85\xC0", 3);
+					JNZ(a, op[5]);
+					JMP(a, op[6]);
+				}
+				break;
+			case OP_IF:
+				lasm_bytes(a, "\x58\x48\x85\xC0", 4);
+				JZ(a, op[0]);
+				break;
+			case OP_JUMP:
+				JMP(a, op[0]);
+				break;
+			case OP_RETURN:
+				lasm_bytes(a, "\x58", 1);
+				JMP(a, LJIT_OK);
+				break;
+			case OP_CALLSYM:
+				ljit_call(a, op[2]);
+				break;
+			case OP_TCALLSYM:
+				ljit_tail(a, op[2]);
+				break;
+			case OP_RECUR:
+				if (op[1]) {
+					ljit_tail(a, op[0]);
+				} else {
+					ljit_call(a, op[0]);
+				}
+				break;
+		}
+	}
+
+	// mov [r12], rax; then one fewer activation
+	lasm_mark(a, LJIT_OK);
+	lasm_bytes(a, "\x49\x89\x04\x24\x48\xB9", 6);
+	lasm_i64(a, (int64_t) (intptr_t) &ljit_depth);
+	lasm_bytes(a, "\x48\xFF\x09\xB8\x01\x00\x00\x00", 8);
+	lasm_epilogue(a);
+
+	lasm_mark(a, LJIT_BAIL);
+	lasm_bytes(a, "\x48\xB9", 2);
+	lasm_i64(a, (int64_t) (intptr_t) &ljit_depth);
+	lasm_bytes(a, "\x48\xFF\x09", 3);
+	lasm_mark(a, LJIT_BAIL_NODEC);
+	lasm_bytes(a, "\x31\xC0", 2);
+	lasm_epilogue(a);
+
+	for (int i = 0; i < a->npatches; i++) {
+		int at = a->patch_at[i];
+		int32_t rel = *lasm_label(a, a->patch_to[i]) - (at + 4);
+		memcpy(a->buf + at, &rel, 4);
+	}
+}
+
+static ljit *
+ljit_compile(lenv *e, lchunk *c) {
+	if (!c->lambda || c->variadic) { return NULL; }
+
+	while (e->par) { e = e->par; }
+	ljit_unit u = { c, e, 0, NULL };
+	char *reach = calloc(c->count + 1, 1);
+	if (!ljit_reach(&u, reach)) {
+		free(reach);
+		free(u.checks);
+		return NULL;
+	}
+
+	lasm a = { 0 };
+	a.labels = malloc(sizeof(int) * c->count);
+	ljit_translate(&a, c, reach);
+	free(reach);
+	free(a.labels);
+	free(a.patch_at);
+	free(a.patch_to);
+
+	size_t page = sysconf(_SC_PAGESIZE);
+	size_t mapped = (a.len + page - 1) / page * page;
+	void *mem = mmap(NULL, mapped, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mem == MAP_FAILED) {
+		free(a.buf);
+		free(u.checks);
+		return NULL;
+	}
+	memcpy(mem, a.buf, a.len);
+	// hosts that refuse executable mappings leave the VM running it
+	if (mprotect(mem, mapped, PROT_READ | PROT_EXEC) != 0) {
+		munmap(mem, mapped);
+		free(a.buf);
+		free(u.checks);
+		return NULL;
+	}
+
+	ljit *j = ljit_new((ljit_fn) mem, mapped, &u);
+
+	ljit_count++;
+	ljit_records = realloc(ljit_records, sizeof(ljit_record) * ljit_count);
+	ljit_records[ljit_count - 1].name = ljit_name(e, c);
+	ljit_records[ljit_count - 1].words = c->count;
+	ljit_records[ljit_count - 1].bytes = a.len;
+
+	free(a.buf);
+	return j;
+}
+
+#else
+
+static ljit *
+ljit_compile(lenv *e, lchunk *c) {
+	return NULL;
+}
+
+#endif
+
+int
+ljit_run(lenv *e, lchunk *c, lval **args, int argc, long *out) {
+	if (!c->jit) {
+		if (c->calls > LJIT_THRESHOLD || ++c->calls < LJIT_THRESHOLD) {
+			return 0;
+		}
+		// past the threshold, so a chunk that cannot be compiled is only
+		// tried the once
+		c->calls++;
+		c->jit = ljit_compile(e, c);
+		if (!c->jit) { return 0; }
+	}
+
+	ljit *j = c->jit;
+	if (j->bails >= LJIT_BAILS) { return 0; }
+	for (int i = 0; i < j->nchecks; i++) {
+		ljit_check *k = &j->checks[i];
+		if (lvm_version(e, k->sym, &k->cache) != k->stamp) { return 0; }
+	}
+
+	// locals sit at descending addresses, as pushed by native calls
+	long locals[argc + 1];
+	for (int i = 0; i < argc; i++) {
+		if (args[i]->type != LVAL_NUM) { return 0; }
+		locals[argc - 1 - i] = args[i]->val.num;
+	}
+
+	// native activations count towards lvm_max_depth as well
+	int room = lvm_max_depth - lvm_depth;
+	if (room <= 0) { return 0; }
+	ljit_depth = room < LJIT_DEPTH ? LJIT_DEPTH - room : 0;
+	int ok = j->fn(argc ? &locals[argc - 1] : locals, out);
+	ljit_depth = 0;
+	if (ok) { return 1; }
+	j->bails++;
+	return 0;
+}
+
+// whether c has the code and constants lispyc translated, but for the
+// stamps in guards, which depend on what the program ran before
+static int
+ljit_same(lchunk *c, const int *code, int count, lval *consts) {
+	if (c->count != count || c->nconsts != consts->count) { return 0; }
+	for (int pc = 0; pc < count; pc += 1 + lop_operands[code[pc]]) {
+		if (c->code[pc] != code[pc]) { return 0; }
+		for (int i = 1; i <= lop_operands[code[pc]]; i++) {
+			if (c->code[pc + i] != code[pc + i] && !(code[pc] == OP_GUARD && i == 3)) {
+				return 0;
+			}
+		}
+	}
+	for (int i = 0; i < c->nconsts; i++) {
+		if (!lval_eq(c->consts[i], consts->cells[i])) { return 0; }
+	}
+	return 1;
+}
+
+/*
+ * Attaches fn, which lispyc translated from code and consts, to the
+ * lambda now bound to the global name if it compiled to the same code
+ * here. Consumes consts.
+ */
+void
+ljit_adopt(lenv *e, char *name, const int *code, int count, lval *consts,
+	ljit_fn fn) {
+	while (e->par) { e = e->par; }
+	lval *f = lenv_find(e, lsym_intern(name, strlen(name)));
+	if (f && f->type == LVAL_LAMBDA && !f->val.context->memo &&
+		lvm_accepts(e, f, f->val.context->formals->count)) {
+		lchunk *c = f->val.context->chunk;
+		ljit_unit u = { c, e, 0, NULL };
+		char *reach = calloc(c->count + 1, 1);
+		if (!c->jit && !c->variadic && ljit_same(c, code, count, consts) &&
+			ljit_reach(&u, reach)) {
+			c->jit = ljit_new(fn, 0, &u);
+		} else {
+			free(u.checks);
+		}
+		free(reach);
+	}
+	lval_del(consts);
+}
+
+void
+ljit_release(ljit *j) {
+	if (!j) { return; }
+#ifdef LJIT_NATIVE
+	if (j->mapped) { munmap((void *) j->fn, j->mapped); }
+#endif
+	free(j->checks);
+	free(j);
+}
+
+void
+ljit_report(void) {
+#ifndef LJIT_NATIVE
+	fprintf(stderr, "jit: not built in\n");
+	return;
+#endif
+	fflush(stdout);
+	int bytes = 0;
+	for (int i = 0; i < ljit_count; i++) {
+		bytes += ljit_records[i].bytes;
+	}
+	fprintf(stderr, "jit: %i functions compiled, %i bytes of native code\n",
+		ljit_count, bytes);
+	for (int i = 0; i < ljit_count; i++) {
+		fprintf(stderr, "jit:   %-16s %5i bytecode words -> %5i bytes\n",
+			ljit_records[i].name, ljit_records[i].words, ljit_records[i].bytes);
+	}
+}
+
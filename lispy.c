@@ -1,8 +1,11 @@
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 #include "mpc/mpc.h"
 #include "lispy.h"
+#include "vm.h"
 
 mpc_parser_t *Number;
 mpc_parser_t *Symbol;
@@ -38,42 +41,6 @@ void add_history(char *unused) {}
 #endif
 #endif
 
-enum { LVAL_ERR, LVAL_NUM, LVAL_FNUM, LVAL_SYM, LVAL_STR,
-	LVAL_FUN, LVAL_SEXPR, LVAL_QEXPR, LVAL_LAMBDA };
-
-
-struct lcontext {
-	lenv *env;
-	lval *formals;
-	lval *body;
-};
-
-typedef union {
-	long num;
-	double fnum;
-	char *sym;
-	char *str;
-	char *err;
-	lbuiltin builtin;
-	lcontext *context;
-} nval;
-
-struct lval {
-	int type;
-	nval val;
-	int count;
-	struct lval **cells;
-};
-
-struct lenv {
-	lenv *par;
-	int count;
-	char **syms;
-	lval **vals;
-};
-
-#define LVAL_NUMBER_VALUE(x) ((*x).type == LVAL_FNUM ? (*x).val.fnum : (*x).val.num)
-
 #define LASSERT(args, cond, fmt, ...) \
 	if (!(cond)) { lval *err = lval_err(fmt, ##__VA_ARGS__); lval_del(args); return err; }
 
@@ -96,30 +63,105 @@ struct lenv {
 	LASSERT(args, args->cells[index]->count != 0, \
 		"function %s passed {} for argument %i.", func, index);
 
+/* Symbols are interned so environments can compare them by pointer */
+
+static char **lsym_table;
+static size_t lsym_cap;
+static size_t lsym_count;
+
+static size_t
+lsym_hash(const char *s, size_t len) {
+	size_t h = 2166136261u;
+	for (size_t i = 0; i < len; i++) {
+		h = (h ^ (unsigned char) s[i]) * 16777619u;
+	}
+	return h;
+}
+
+char *
+lsym_intern(const char *s, size_t len) {
+	// grow at half load so probe sequences stay short
+	if (lsym_count * 2 >= lsym_cap) {
+		size_t cap = lsym_cap ? lsym_cap * 2 : 256;
+		char **table = calloc(cap, sizeof(char *));
+		for (size_t i = 0; i < lsym_cap; i++) {
+			if (!lsym_table[i]) { continue; }
+			size_t j = lsym_hash(lsym_table[i], strlen(lsym_table[i])) & (cap - 1);
+			while (table[j]) { j = (j + 1) & (cap - 1); }
+			table[j] = lsym_table[i];
+		}
+		free(lsym_table);
+		lsym_table = table;
+		lsym_cap = cap;
+	}
+
+	size_t i = lsym_hash(s, len) & (lsym_cap - 1);
+	while (lsym_table[i]) {
+		if (strncmp(lsym_table[i], s, len) == 0 && lsym_table[i][len] == '\0') {
+			return lsym_table[i];
+		}
+		i = (i + 1) & (lsym_cap - 1);
+	}
+
+	char *sym = (char *) malloc(len + 2) + 1;
+	LSYM_LOCAL(sym) = 0;
+	memcpy(sym, s, len);
+	sym[len] = '\0';
+	lsym_table[i] = sym;
+	lsym_count++;
+	return sym;
+}
+
+static char *lsym_specials[] = { "if", "\\", "def", "=" };
+
+// whether sym names a special form, which no definition may rebind
+int
+lsym_special(char *sym) {
+	static char *interned[4];
+	for (int i = 0; i < 4; i++) {
+		if (!interned[i]) {
+			interned[i] = lsym_intern(lsym_specials[i], strlen(lsym_specials[i]));
+		}
+		if (sym == interned[i]) { return 1; }
+	}
+	return 0;
+}
+
 lenv *
 lenv_new(void) {
 	lenv *e = malloc(sizeof(*e));
 	e->par = NULL;
 	e->count = 0;
+	e->borrowed = 0;
 	e->syms = NULL;
 	e->vals = NULL;
+	e->vers = NULL;
 	return e;
 }
 
 void
 lenv_del(lenv *e) {
 	for (int i = 0; i < e->count; i++) {
-		free(e->syms[i]);
 		lval_del(e->vals[i]);
 	}
 	free(e->syms);
 	free(e->vals);
+	free(e->vers);
 	free(e);
 }
 
+// values allocated so far, for --alloc-stats
+long lval_allocs;
+
+static lval *
+lval_alloc(void) {
+	lval_allocs++;
+	return malloc(sizeof(lval));
+}
+
 lval *
 lval_err(char *fmt, ...) {
-	lval *v = malloc(sizeof(*v));
+	lval *v = lval_alloc();
 	v->type = LVAL_ERR;
 
 	va_list va;
@@ -140,7 +182,7 @@ lval_err(char *fmt, ...) {
 
 lval *
 lval_num(long x) {
-	lval *v = malloc(sizeof(*v));
+	lval *v = lval_alloc();
 	v->type = LVAL_NUM;
 	v->val.num = x;
 	v->count = 0;
@@ -150,7 +192,7 @@ lval_num(long x) {
 
 lval *
 lval_fnum(double x) {
-	lval *v = malloc(sizeof(*v));
+	lval *v = lval_alloc();
 	v->type = LVAL_FNUM;
 	v->val.fnum = x;
 	v->count = 0;
@@ -160,21 +202,32 @@ lval_fnum(double x) {
 
 lval *
 lval_sym(char *s) {
-	// printf("allocationg symbol: %s\n", s);
-	lval *v = malloc(sizeof(*v));
+	return lval_symn(s, strlen(s));
+}
+
+// the symbol named by the n characters at s, which need no terminator
+lval *
+lval_symn(const char *s, size_t n) {
+	lval *v = lval_alloc();
 	v->type = LVAL_SYM;
-	v->val.sym = malloc(strlen(s) + 1);
-	strcpy(v->val.sym, s);
+	v->val.sym = lsym_intern(s, n);
 	v->count = 0;
 	v->cells = NULL;
 	return v;
 }
 
 lval *lval_str(char *s) {
-	lval *v = malloc(sizeof(*v));
+	return lval_strn(s, strlen(s));
+}
+
+// the string of the n characters at s, which need no terminator
+lval *
+lval_strn(const char *s, size_t n) {
+	lval *v = lval_alloc();
 	v->type = LVAL_STR;
-	v->val.str = malloc(strlen(s) + 1);
-	strcpy(v->val.str, s);
+	v->val.str = malloc(n + 1);
+	memcpy(v->val.str, s, n);
+	v->val.str[n] = '\0';
 	v->count = 0;
 	v->cells = NULL;
 	return v;
@@ -182,7 +235,7 @@ lval *lval_str(char *s) {
 
 lval *
 lval_sexpr(void) {
-	lval *v = malloc(sizeof(*v));
+	lval *v = lval_alloc();
 	v->type = LVAL_SEXPR;
 	v->count = 0;
 	v->cells = NULL;
@@ -191,7 +244,7 @@ lval_sexpr(void) {
 
 lval *
 lval_qexpr(void) {
-	lval *v = malloc(sizeof(*v));
+	lval *v = lval_alloc();
 	v->type = LVAL_QEXPR;
 	v->count = 0;
 	v->cells = NULL;
@@ -200,61 +253,226 @@ lval_qexpr(void) {
 
 lval *
 lval_fun(lbuiltin fun) {
-	lval *v = malloc(sizeof(*v));
+	lval *v = lval_alloc();
 	v->type = LVAL_FUN;
 	v->val.builtin = fun;
+	v->count = 0;
+	v->cells = NULL;
 	return v;
 }
 
 lval *
 lval_lambda(lval *formals, lval *body) {
-	lval *v = malloc(sizeof(*v));
+	lval *v = lval_alloc();
 	v->type = LVAL_LAMBDA;
 
+	// the formals will be bound in scopes of their own
+	for (int i = 0; i < formals->count; i++) {
+		if (formals->cells[i]->type == LVAL_SYM) {
+			LSYM_LOCAL(formals->cells[i]->val.sym) = 1;
+		}
+	}
+
 	lcontext *c = malloc(sizeof (*c));
+	c->refs = 1;
 	c->env = lenv_new();
 	c->formals = formals;
 	c->body = body;
+	c->chunk = NULL;
+	c->memo = NULL;
 
 	v->val.context = c;
+	v->count = 0;
+	v->cells = NULL;
+	return v;
+}
+
+static void
+lcontext_release(lcontext *c) {
+	if (--c->refs > 0) { return; }
+	lenv_del(c->env);
+	lval_del(c->formals);
+	lval_del(c->body);
+	lchunk_release(c->chunk);
+	lmemo_release(c->memo);
+	free(c);
+}
+
+// gives the lambda f a context of its own, for changes the copies it
+// shares one with must not see
+static lcontext *
+lcontext_own(lval *f) {
+	lcontext *c = f->val.context;
+	if (c->refs == 1) { return c; }
+
+	lcontext *x = malloc(sizeof(*x));
+	x->refs = 1;
+	x->env = lenv_copy(c->env);
+	x->formals = lval_copy(c->formals);
+	x->body = lval_copy(c->body);
+	x->chunk = lchunk_retain(c->chunk);
+	x->memo = lmemo_retain(c->memo);
+	c->refs--;
+	f->val.context = x;
+	return x;
+}
+
+// applies f, a lambda or partial application, to too few arguments a,
+// consuming a
+lval *
+lval_partial(lval *f, lval *a) {
+	lpartial *p = malloc(sizeof(*p));
+	p->refs = 1;
+	if (f->type == LVAL_PARTIAL) {
+		p->fn = NULL;
+		p->up = f->val.partial;
+		p->up->refs++;
+		p->bound = p->up->bound + a->count;
+	} else {
+		p->fn = lval_copy(f);
+		p->up = NULL;
+		p->bound = a->count;
+	}
+	p->count = a->count;
+	p->args = a->cells;
+	a->count = 0;
+	a->cells = NULL;
+	lval_del(a);
+
+	lval *v = lval_alloc();
+	v->type = LVAL_PARTIAL;
+	v->val.partial = p;
+	v->count = 0;
+	v->cells = NULL;
 	return v;
 }
 
+static void
+lpartial_release(lpartial *p) {
+	if (--p->refs > 0) { return; }
+	for (int i = 0; i < p->count; i++) {
+		lval_del(p->args[i]);
+	}
+	free(p->args);
+	if (p->fn) { lval_del(p->fn); }
+	if (p->up) { lpartial_release(p->up); }
+	free(p);
+}
+
+// the lambda a partial application applies
+lval *
+lpartial_fn(lpartial *p) {
+	while (p->up) { p = p->up; }
+	return p->fn;
+}
+
+// stores copies of all the arguments given so far, in order, into out
+void
+lpartial_args(lpartial *p, lval **out) {
+	if (p->up) { lpartial_args(p->up, out); }
+	for (int i = 0; i < p->count; i++) {
+		out[p->bound - p->count + i] = lval_copy(p->args[i]);
+	}
+}
+
+// arguments f, a lambda or partial application, takes before it runs:
+// its formals ahead of any '&', less those already given
+int
+lval_needs(lval *f) {
+	int bound = 0;
+	if (f->type == LVAL_PARTIAL) {
+		bound = f->val.partial->bound;
+		f = lpartial_fn(f->val.partial);
+	}
+	lval *formals = f->val.context->formals;
+	int n = 0;
+	while (n < formals->count && strcmp(formals->cells[n]->val.sym, "&") != 0) {
+		n++;
+	}
+	return n - bound;
+}
+
+// whether the lambda f takes any number of arguments past its formals
+int
+lval_variadic(lval *f) {
+	lval *formals = f->val.context->formals;
+	for (int i = 0; i < formals->count; i++) {
+		if (strcmp(formals->cells[i]->val.sym, "&") == 0) { return 1; }
+	}
+	return 0;
+}
+
 lval *
 lenv_get(lenv *e, lval *k) {
 	// iterate over all items in the environment
 	for (int i = 0; i < e->count; i++) {
-		if (strcmp(e->syms[i], k->val.sym) == 0){
+		if (e->syms[i] == k->val.sym) {
 			return lval_copy(e->vals[i]);
 		}
 	}
-	// if no symbol, check in parent, otherwise error
+	// if no symbol, check in parent, then in modules not yet loaded
 	if (e->par) {
 		return lenv_get(e->par, k);
 	}
+	lval *v = lenv_autoload(e, k->val.sym);
+	if (v) { return lval_copy(v); }
 	return lval_err("Unbound symbol '%s',", k->val.sym);
 }
 
+// the value bound to sym, without copying it
+lval *
+lenv_find(lenv *e, char *sym) {
+	for (; e; e = e->par) {
+		for (int i = 0; i < e->count; i++) {
+			if (e->syms[i] == sym) { return e->vals[i]; }
+		}
+	}
+	return NULL;
+}
+
+// source of binding stamps; zero is never handed out
+static unsigned lenv_clock;
+
+// gives e arrays of its own in place of the frame storage it borrows
+void
+lenv_own(lenv *e) {
+	if (!e->borrowed) { return; }
+	char **syms = malloc(sizeof(char *) * (e->count + 1));
+	lval **vals = malloc(sizeof(lval *) * (e->count + 1));
+	memcpy(syms, e->syms, sizeof(char *) * e->count);
+	memcpy(vals, e->vals, sizeof(lval *) * e->count);
+	e->syms = syms;
+	e->vals = vals;
+	e->vers = calloc(e->count + 1, sizeof(unsigned));
+	e->borrowed = 0;
+}
+
 void
 lenv_put(lenv *e, lval *k, lval *v) {
 	// iterate over all item in env. to see if variable exists
 	for (int i = 0; i < e->count; i++) {
 		// if variable is found, delete & replace w/user defined var
-		if (strcmp(e->syms[i], k->val.sym) == 0) {
+		if (e->syms[i] == k->val.sym) {
 			lval_del(e->vals[i]);
 			e->vals[i] = lval_copy(v);
+			if (e->vers) { e->vers[i] = ++lenv_clock; }
 			return;
 		}
 	}
 
+	// frame storage belongs to the VM, so take a private copy first
+	lenv_own(e);
+
 	// if no entry found, add new entry
 	e->count++;
 	e->vals = realloc(e->vals, sizeof(lval *) * e->count);
 	e->syms = realloc(e->syms, sizeof(char *) * e->count);
+	e->vers = realloc(e->vers, sizeof(unsigned) * e->count);
 
 	e->vals[e->count - 1] = lval_copy(v);
-	e->syms[e->count - 1] = malloc(strlen(k->val.sym) + 1);
-	strcpy(e->syms[e->count - 1], k->val.sym);
+	e->syms[e->count - 1] = k->val.sym;
+	e->vers[e->count - 1] = ++lenv_clock;
+	if (e->par) { LSYM_LOCAL(k->val.sym) = 1; }
 }
 
 void
@@ -265,16 +483,15 @@ lval_del(lval *v) {
 		case LVAL_FUN:
 			break;
 		case LVAL_LAMBDA:
-			lenv_del(v->val.context->env);
-			lval_del(v->val.context->formals);
-			lval_del(v->val.context->body);
-			free(v->val.context);
+			lcontext_release(v->val.context);
+			break;
+		case LVAL_PARTIAL:
+			lpartial_release(v->val.partial);
 			break;
 		case LVAL_ERR:
 			free(v->val.err);
 			break;
 		case LVAL_SYM:
-			free(v->val.sym);
 			break;
 		case LVAL_STR:
 			free(v->val.str);
@@ -304,11 +521,11 @@ lval_read_num(mpc_ast_t *t) {
 
 lval *
 lval_read_str(mpc_ast_t *t) {
-	// cut off final quote character
-	t->contents[strlen(t->contents) - 1] = '\0';
-	// copy the string while removing first quote character
-	char *unescaped = malloc(strlen(t->contents + 1) + 1);
-	strcpy(unescaped, t->contents + 1);
+	// copy the string without its quote characters, leaving the node intact
+	size_t len = strlen(t->contents) - 2;
+	char *unescaped = malloc(len + 1);
+	memcpy(unescaped, t->contents + 1, len);
+	unescaped[len] = '\0';
 	// pass through unescape function
 	unescaped = mpcf_unescape(unescaped);
 	// construct new lval using the string
@@ -318,29 +535,58 @@ lval_read_str(mpc_ast_t *t) {
 	return str;
 }
 
-lval *
-lval_read(mpc_ast_t *t) {
-	if (strstr(t->tag, "number")) { return lval_read_num(t); }
-	if (strstr(t->tag, "symbol")) { return lval_sym(t->contents); }
-	if (strstr(t->tag, "string")) { return lval_read_str(t); }
+enum { LREAD_SKIP, LREAD_ROOT, LREAD_NUMBER, LREAD_SYMBOL, LREAD_STRING,
+	LREAD_SEXPR, LREAD_QEXPR };
+
+// the grammar rule that produced a node, from its tag: mpc joins the rule
+// names on the way down with '|', so "expr|number|regex" is a number and
+// "sexpr|>" a list; the root is ">", and parentheses, braces and the
+// anchors around the program are "char" and "regex" nodes
+static int
+lval_read_tag(const char *tag) {
+	static const struct { const char *name; size_t len; int id; } rules[] = {
+		{"number", 6, LREAD_NUMBER}, {"symbol", 6, LREAD_SYMBOL},
+		{"string", 6, LREAD_STRING}, {"sexpr", 5, LREAD_SEXPR},
+		{"qexpr", 5, LREAD_QEXPR},
+	};
+	const char *last = strrchr(tag, '|');
+	if (!last) { return tag[0] == '>' && !tag[1] ? LREAD_ROOT : LREAD_SKIP; }
+	const char *rule = last;
+	while (rule > tag && rule[-1] != '|') { rule--; }
+	size_t len = last - rule;
+	for (size_t i = 0; i < sizeof(rules) / sizeof(rules[0]); i++) {
+		if (rules[i].len == len && memcmp(rules[i].name, rule, len) == 0) {
+			return rules[i].id;
+		}
+	}
+	// comments
+	return LREAD_SKIP;
+}
 
-	lval *x = NULL;
-	if (strcmp(t->tag, ">") == 0) { x = lval_sexpr(); }
-	if (strstr(t->tag, "sexpr")) { x = lval_sexpr(); }
-	if (strstr(t->tag, "qexpr")) { x = lval_qexpr(); }
+static lval *
+lval_read_node(mpc_ast_t *t, int tag) {
+	lval *x;
+	switch (tag) {
+		case LREAD_NUMBER: return lval_read_num(t);
+		case LREAD_SYMBOL: return lval_sym(t->contents);
+		case LREAD_STRING: return lval_read_str(t);
+		case LREAD_QEXPR: x = lval_qexpr(); break;
+		default: x = lval_sexpr(); break;
+	}
 
 	for (int i = 0; i < t->children_num; i++) {
-		if (strcmp(t->children[i]->contents, "(") == 0) { continue; }
-		if (strcmp(t->children[i]->contents, ")") == 0) { continue; }
-		if (strcmp(t->children[i]->contents, "{") == 0) { continue; }
-		if (strcmp(t->children[i]->contents, "}") == 0) { continue; }
-		if (strcmp(t->children[i]->tag, "regex") == 0) { continue; }
-		if (strstr(t->children[i]->tag, "comment")) { continue; }
-		x = lval_add(x, lval_read(t->children[i]));
+		int child = lval_read_tag(t->children[i]->tag);
+		if (child == LREAD_SKIP) { continue; }
+		x = lval_add(x, lval_read_node(t->children[i], child));
 	}
 	return x;
 }
 
+lval *
+lval_read(mpc_ast_t *t) {
+	return lval_read_node(t, lval_read_tag(t->tag));
+}
+
 lval *
 lval_add(lval *v, lval *x) {
 	v->count++;
@@ -362,6 +608,22 @@ lval_expr_print(lval *v, char open, char close) {
 	putchar(close);
 }
 
+// a partial application, as the lambda it stands for without the formals
+// given; apart from lval_print, as its locals would grow every frame of
+// the recursion through nested lists
+static void
+lval_print_partial(lval *v) {
+	lval *fn = lpartial_fn(v->val.partial);
+	lval *formals = fn->val.context->formals;
+	printf("(\\ {");
+	for (int i = v->val.partial->bound; i < formals->count; i++) {
+		lval_print(formals->cells[i]);
+		if (i != formals->count - 1) { putchar(' '); }
+	}
+	printf("} ");
+	lval_print(fn->val.context->body);
+}
+
 void
 lval_print(lval *v) {
 	switch(v->type) {
@@ -380,6 +642,9 @@ lval_print(lval *v) {
 			putchar(' ');
 			lval_print(v->val.context->body);
 			break;
+		case LVAL_PARTIAL:
+			lval_print_partial(v);
+			break;
 		case LVAL_ERR:
 			printf("Error: %s", v->val.err);
 			return;
@@ -399,7 +664,7 @@ lval_print(lval *v) {
 
 lval *
 lval_copy(lval *v) {
-	lval *x = malloc(sizeof(*x));
+	lval *x = lval_alloc();
 	x->type = v->type;
 	x->count = 0;
 	x->cells = NULL;
@@ -415,18 +680,20 @@ lval_copy(lval *v) {
 			x->val.builtin = v->val.builtin;
 			break;
 		case LVAL_LAMBDA:
-			x->val.context = malloc(sizeof(*(x->val.context)));
-			x->val.context->env = lenv_copy(v->val.context->env);
-			x->val.context->formals = lval_copy(v->val.context->formals);
-			x->val.context->body = lval_copy(v->val.context->body);
+			x->val.context = v->val.context;
+			x->val.context->refs++;
+			break;
+		case LVAL_PARTIAL:
+			x->val.partial = v->val.partial;
+			x->val.partial->refs++;
 			break;
 		case LVAL_SYM:
-			x->val.sym = malloc(strlen(v->val.sym) + 1);
-			strcpy(x->val.sym, v->val.sym);
+			x->val.sym = v->val.sym;
 			break;
 		case LVAL_STR:
 			x->val.str = malloc(strlen(v->val.str) + 1);
 			strcpy(x->val.str, v->val.str);
+			break;
 		case LVAL_ERR:
 			x->val.err = malloc(strlen(v->val.err) + 1);
 			strcpy(x->val.err, v->val.err);
@@ -464,6 +731,10 @@ ltype_name(int t) {
 	switch (t) {
 		case LVAL_FUN:
 			return "Function";
+		case LVAL_LAMBDA:
+			return "Lambda";
+		case LVAL_PARTIAL:
+			return "Partial Application";
 		case LVAL_NUM:
 		case LVAL_FNUM:
 			return "Number";
@@ -482,53 +753,194 @@ ltype_name(int t) {
 	}
 }
 
-lval *
-lval_eval(lenv *e, lval *v) {
-	if (v->type == LVAL_SYM) {
-		lval *x = lenv_get(e, v);
-		lval_del(v);
-		return x;
-	}
-	// evaluate S-expressions
-	if (v->type == LVAL_SEXPR) { return lval_eval_sexpr(e, v); }
-	// other types remain the same
-	return v;
-}
+/*
+ * 'if', '\', 'def' and '=' written with literal Q-expressions are special
+ * forms: they read their arguments straight from the source expression,
+ * so the branch 'if' does not take is never copied. Returns NULL when v is
+ * not such a form, leaving it to an ordinary call of the builtin b.
+ */
+static lval *lval_eval_in(lenv *, lval *, int);
+
+static lval *
+lval_special(lenv *e, lval *v, lbuiltin b) {
+	if (b != builtin_lambda && b != builtin_def && b != builtin_put) {
+		return NULL;
+	}
 
-lval *
-lval_eval_sexpr(lenv *e, lval *v) {
-	for (int i = 0; i < v->count; i++) {
-		v->cells[i] = lval_eval(e, v->cells[i]);
+	lval *syms = v->cells[1];
+	if (syms->type != LVAL_QEXPR) { return NULL; }
+	for (int i = 0; i < syms->count; i++) {
+		if (syms->cells[i]->type != LVAL_SYM || lsym_special(syms->cells[i]->val.sym)) {
+			return NULL;
+		}
 	}
 
-	// check errors
-	for(int i = 0; i < v->count; i++) {
-		if (v->cells[i]->type == LVAL_ERR) { return lval_take(v, i); }
+	if (b == builtin_lambda) {
+		if (v->count != 3 || v->cells[2]->type != LVAL_QEXPR) { return NULL; }
+		lval *formals = lval_copy(syms);
+		return lval_lambda(formals, lval_copy(v->cells[2]));
 	}
 
-	// empty expression
-	if (v->count == 0) { return v; }
+	if (syms->count != v->count - 2) { return NULL; }
 
-	// single expression
-	if (v->count == 1) { return lval_take(v, 0); }
+	lval *a = lval_sexpr();
+	for (int i = 2; i < v->count; i++) {
+		lval_add(a, lval_eval_in(e, v->cells[i], 0));
+	}
+	for (int i = 0; i < a->count; i++) {
+		if (a->cells[i]->type == LVAL_ERR) { return lval_take(a, i); }
+	}
 
-	// ensure first element is function after evaluation
-	lval *f = lval_pop(v, 0);
-	if (f->type != LVAL_FUN && f->type != LVAL_LAMBDA) {
-		lval *err = lval_err(
-			"S-expression starts with incorrect type. "
-			"Got %s, expected %s or %s.",
-			ltype_name(f->type),
-			ltype_name(LVAL_FUN),
-			ltype_name(LVAL_LAMBDA));
-		lval_del(f);
-		lval_del(v);
-		return err;
+	for (int i = 0; i < syms->count; i++) {
+		if (b == builtin_def) {
+			lenv_def(e, syms->cells[i], a->cells[i]);
+		} else {
+			lenv_put(e, syms->cells[i], a->cells[i]);
+		}
 	}
+	lval_del(a);
+	return lval_sexpr();
+}
 
-	lval *result = lval_call(e, f, v);
-	lval_del(f);
-	return result;
+/*
+ * Evaluates v in e without consuming it. With cells set, the cells of v
+ * are evaluated as an S-expression whatever its type, which is how lambda
+ * bodies and the branches of 'if' run in place.
+ *
+ * Calls in tail position -- a lambda's body, the branch 'if' picks and
+ * the argument of 'eval' -- replace the expression being evaluated
+ * instead of recursing, so recursive loops run in constant C stack.
+ */
+static lval *
+lval_eval_in(lenv *e, lval *v, int cells) {
+	// lambda whose environment e is
+	lval *scope = NULL;
+
+	// expression built at runtime, by 'eval', that v points into
+	lval *held = NULL;
+	lval *r;
+
+	if (!lvm_nest()) { return lval_err("stack depth exceeded"); }
+
+	for (;;) {
+		if (!cells && v->type == LVAL_SYM) { r = lenv_get(e, v); break; }
+		if (!cells && v->type != LVAL_SEXPR) { r = lval_copy(v); break; }
+		cells = 0;
+
+		// empty expression
+		if (v->count == 0) { r = lval_sexpr(); break; }
+
+		// single expression
+		if (v->count == 1) { v = v->cells[0]; continue; }
+
+		lval *head = v->cells[0];
+		lval *b = NULL;
+		if (head->type == LVAL_SYM && lsym_special(head->val.sym)) {
+			b = lenv_find(e, head->val.sym);
+		}
+		if (b && b->type != LVAL_FUN) { b = NULL; }
+
+		if (b && b->val.builtin == builtin_if && v->count == 4 &&
+			v->cells[2]->type == LVAL_QEXPR && v->cells[3]->type == LVAL_QEXPR) {
+			lval *c = lval_eval_in(e, v->cells[1], 0);
+			if (c->type == LVAL_NUM) {
+				v = v->cells[c->val.num ? 2 : 3];
+				cells = 1;
+				lval_del(c);
+				continue;
+			}
+			if (c->type == LVAL_ERR) { r = c; break; }
+
+			// let the builtin report the bad condition
+			lval *a = lval_add(lval_sexpr(), c);
+			lval_add(a, lval_copy(v->cells[2]));
+			lval_add(a, lval_copy(v->cells[3]));
+			r = builtin_if(e, a);
+			break;
+		}
+		if (b && (r = lval_special(e, v, b->val.builtin))) { break; }
+
+		lval *a = lval_sexpr();
+		for (int i = 0; i < v->count; i++) {
+			lval_add(a, lval_eval_in(e, v->cells[i], 0));
+		}
+
+		// check errors
+		int err = -1;
+		for (int i = 0; i < a->count && err < 0; i++) {
+			if (a->cells[i]->type == LVAL_ERR) { err = i; }
+		}
+		if (err >= 0) { r = lval_take(a, err); break; }
+
+		// ensure first element is function after evaluation
+		lval *f = lval_pop(a, 0);
+		if (f->type != LVAL_FUN && f->type != LVAL_LAMBDA &&
+			f->type != LVAL_PARTIAL) {
+			r = lval_err(
+				"S-expression starts with incorrect type. "
+				"Got %s, expected %s or %s.",
+				ltype_name(f->type),
+				ltype_name(LVAL_FUN),
+				ltype_name(LVAL_LAMBDA));
+			lval_del(f);
+			lval_del(a);
+			break;
+		}
+
+		lval *x = lval_tail(f, a);
+		if (x) {
+			lval_del(f);
+			if (held) { lval_del(held); }
+			held = v = x;
+			continue;
+		}
+
+		if (f->type != LVAL_LAMBDA || f->val.context->memo ||
+			lvm_accepts(e, f, a->count) ||
+			(a->count && a->count < lval_needs(f))) {
+			r = lval_call(e, f, a);
+			lval_del(f);
+			break;
+		}
+
+		x = lval_bind(e, f, a);
+		if (x) {
+			lval_del(f);
+			r = x;
+			break;
+		}
+
+		// f's body can still reach what its formals leave of the current
+		// scope, so that moves into f's before the current one is dropped
+		lenv *fenv = f->val.context->env;
+		if (scope) {
+			lenv_carry(fenv, e);
+			fenv->par = e->par;
+			lval_del(scope);
+		} else {
+			fenv->par = e;
+		}
+		scope = f;
+		e = fenv;
+
+		v = f->val.context->body;
+		cells = 1;
+	}
+
+	if (held) { lval_del(held); }
+	if (scope) { lval_del(scope); }
+	lvm_nesting--;
+	return r;
+}
+
+lval *
+lval_eval(lenv *e, lval *v) {
+	// everything but symbols and S-expressions evaluates to itself
+	if (v->type != LVAL_SYM && v->type != LVAL_SEXPR) { return v; }
+
+	lval *x = lval_eval_in(e, v, 0);
+	lval_del(v);
+	return x;
 }
 
 lval *
@@ -552,6 +964,67 @@ lval_take(lval *v, int i) {
 	return x;
 }
 
+static lval *lval_call_lambda(lenv *, lval *, lval *);
+
+// calls f, which is wrapped by 'memo', through its table
+static lval *
+lval_call_memo(lenv *e, lval *f, lval *a) {
+	lmemo *m = f->val.context->memo;
+	lval *r = lmemo_get(m, a->cells, a->count);
+	if (r) {
+		lval_del(a);
+		return lval_copy(r);
+	}
+
+	lval *key = lval_copy(a);
+	r = lval_call_lambda(e, f, a);
+
+	// errors such as exceeding the stack depth may not recur
+	if (r->type == LVAL_ERR) {
+		lval_del(key);
+	} else {
+		lmemo_put(m, key, r);
+	}
+	return r;
+}
+
+// calls the lambda behind partial application f, with at least as many
+// arguments as it still needs
+static lval *
+lval_call_partial(lenv *e, lval *f, lval *a) {
+	if (a->count == 0) {
+		lval_del(a);
+		return lval_copy(f);
+	}
+
+	lpartial *p = f->val.partial;
+	lval *fn = lpartial_fn(p);
+	int needs = lval_needs(f);
+	if (a->count > needs && !lval_variadic(fn)) {
+		lval *err = lval_err("function passed too many arguments. "
+			"Got %i, expeceted %i.", a->count, needs);
+		lval_del(a);
+		return err;
+	}
+
+	lval *all = lval_sexpr();
+	all->count = p->bound + a->count;
+	all->cells = malloc(sizeof(lval *) * all->count);
+	lpartial_args(p, all->cells);
+	memcpy(&all->cells[p->bound], a->cells, sizeof(lval *) * a->count);
+	a->count = 0;
+	lval_del(a);
+
+	// fn is shared, and binding outside the VM would pop its formals
+	if (lvm_accepts(e, fn, all->count)) {
+		return lval_call(e, fn, all);
+	}
+	fn = lval_copy(fn);
+	lval *r = lval_call(e, fn, all);
+	lval_del(fn);
+	return r;
+}
+
 lval *
 lval_call(lenv *e, lval *f, lval *a) {
 	// if builtin, call that
@@ -559,6 +1032,47 @@ lval_call(lenv *e, lval *f, lval *a) {
 		return f->val.builtin(e, a);
 	}
 
+	// too few arguments leave them aside until the rest arrive
+	if (a->count && a->count < lval_needs(f)) {
+		return lval_partial(f, a);
+	}
+
+	if (f->type == LVAL_PARTIAL) {
+		return lval_call_partial(e, f, a);
+	}
+
+	if (f->val.context->memo) {
+		return lval_call_memo(e, f, a);
+	}
+	return lval_call_lambda(e, f, a);
+}
+
+static lval *
+lval_call_lambda(lenv *e, lval *f, lval *a) {
+	// run compiled code when the arguments bind without partial application
+	if (lvm_accepts(e, f, a->count)) {
+		return lvm_call(e, f, a);
+	}
+
+	lval *r = lval_bind(e, f, a);
+	if (r) { return r; }
+
+	// all formals are bound, so evaluate the body in f's environment
+	f->val.context->env->par = e;
+	return lval_eval_in(f->val.context->env, f->val.context->body, 1);
+}
+
+/*
+ * Binds the arguments in a to f's formals, consuming a. Returns NULL once
+ * every formal is bound, otherwise an error or the partially applied f.
+ */
+lval *
+lval_bind(lenv *e, lval *f, lval *a) {
+	// binding pops formals, so compiled code no longer matches this copy
+	lcontext_own(f);
+	lchunk_release(f->val.context->chunk);
+	f->val.context->chunk = NULL;
+
 	int given = a->count;
 	int total = f->val.context->formals->count;
 
@@ -625,34 +1139,41 @@ lval_call(lenv *e, lval *f, lval *a) {
 		lval_del(sym);
 		lval_del(val);
 	}
- 
-	// if all formals have been bound, evaluate
-	if (f->val.context->formals->count == 0) {
-		f->val.context->env->par = e;
 
-		// evaluate and return
-		return builtin_eval(f->val.context->env,
-			lval_add(lval_sexpr(), lval_copy(f->val.context->body)));
-	} else {
-		// return partially evaluated function
-		return lval_copy(f);
+	// if all formals have been bound, the body is ready to evaluate
+	if (f->val.context->formals->count == 0) {
+		return NULL;
 	}
 
+	// return partially evaluated function
+	return lval_copy(f);
+}
 
-	// assign each argument fo each formal in order
-	for (int i = 0; i < a->count; i++) {
-		lenv_put(f->val.context->env,
-			f->val.context->formals->cells[i], a->cells[i]);
-	}
-
-	lval_del(a);
+/*
+ * When applying f to a only evaluates another expression in the caller's
+ * scope, as 'eval' and 'if' do, consumes a and returns that expression as
+ * an S-expression. Returns NULL, leaving a alone, otherwise.
+ */
+lval *
+lval_tail(lval *f, lval *a) {
+	if (f->type != LVAL_FUN) { return NULL; }
 
-	// set parent environment
-	f->val.context->env->par = e;
+	lval *x;
+	if (f->val.builtin == builtin_eval) {
+		if (a->count != 1 || a->cells[0]->type != LVAL_QEXPR) { return NULL; }
+		x = lval_take(a, 0);
+	} else if (f->val.builtin == builtin_if) {
+		if (a->count != 3 || a->cells[0]->type != LVAL_NUM ||
+			a->cells[1]->type != LVAL_QEXPR || a->cells[2]->type != LVAL_QEXPR) {
+			return NULL;
+		}
+		x = lval_take(a, a->cells[0]->val.num ? 1 : 2);
+	} else {
+		return NULL;
+	}
 
-	// evaluate the body
-	return builtin_eval(f->val.context->env,
-		lval_add(lval_sexpr(), lval_copy(f->val.context->body)));
+	x->type = LVAL_SEXPR;
+	return x;
 }
 
 lenv *
@@ -660,17 +1181,52 @@ lenv_copy(lenv *e) {
 	lenv *n = malloc(sizeof(*n));
 	n->par = e->par;
 	n->count = e->count;
+	n->borrowed = 0;
 	n->syms = malloc(sizeof(char *) * n->count);
 	n->vals = malloc(sizeof(lval *) * n->count);
+	n->vers = calloc(n->count, sizeof(unsigned));
 
 	for(int i = 0; i < n->count; i++) {
-		n->syms[i] = malloc(strlen(e->syms[i]) + 1);
-		strcpy(n->syms[i], e->syms[i]);
+		n->syms[i] = e->syms[i];
 		n->vals[i] = lval_copy(e->vals[i]);
+		if (e->vers) { n->vers[i] = e->vers[i]; }
 	}
 	return n;
 }
 
+/*
+ * Moves the bindings of from that to has none of its own for into to,
+ * leaving the rest in from. A tail call carries the caller's scope into
+ * the callee's this way, so the caller's can be released.
+ */
+void
+lenv_carry(lenv *to, lenv *from) {
+	int kept = 0;
+	for (int i = 0; i < from->count; i++) {
+		char *sym = from->syms[i];
+		int bound = 0;
+		for (int j = 0; j < to->count && !bound; j++) {
+			bound = to->syms[j] == sym;
+		}
+		if (bound) {
+			from->syms[kept] = sym;
+			from->vals[kept] = from->vals[i];
+			if (from->vers) { from->vers[kept] = from->vers[i]; }
+			kept++;
+			continue;
+		}
+
+		to->count++;
+		to->vals = realloc(to->vals, sizeof(lval *) * to->count);
+		to->syms = realloc(to->syms, sizeof(char *) * to->count);
+		to->vers = realloc(to->vers, sizeof(unsigned) * to->count);
+		to->vals[to->count - 1] = from->vals[i];
+		to->syms[to->count - 1] = sym;
+		to->vers[to->count - 1] = ++lenv_clock;
+	}
+	from->count = kept;
+}
+
 void
 lenv_def(lenv *e, lval *k, lval *v) {
 	// iterate until e has no parent
@@ -698,6 +1254,9 @@ lenv_add_builtins(lenv *e) {
 	lenv_add_builtin(e, "\\", builtin_lambda);
 	lenv_add_builtin(e, "def", builtin_def);
 	lenv_add_builtin(e, "=", builtin_put);
+	lenv_add_builtin(e, "memo", builtin_memo);
+	lenv_add_builtin(e, "loop", builtin_loop);
+	lenv_add_builtin(e, "recur", builtin_recur);
 
 	// list fuctions
 	lenv_add_builtin(e, "list", builtin_list);
@@ -722,62 +1281,19 @@ lenv_add_builtins(lenv *e) {
 	lenv_add_builtin(e, "<=", builtin_le);
 
 	lenv_add_builtin(e, "load", builtin_load);
+	lenv_add_builtin(e, "autoload", builtin_autoload);
+	lenv_add_builtin(e, "save-image", builtin_save_image);
 	lenv_add_builtin(e, "print", builtin_print);
 	lenv_add_builtin(e, "error", builtin_error);
 }
 
-lval *
-builtin_add(lenv *e, lval *a) {
-	return builtin_op(e, a, "+");
-}
-
-lval *
-builtin_sub(lenv *e, lval *a) {
-	return builtin_op(e, a, "-");
-}
-
-lval *
-builtin_mul(lenv *e, lval *a) {
-	return builtin_op(e, a, "*");
-}
-
-lval *
-builtin_div(lenv *e, lval *a) {
-	return builtin_op(e, a, "/");
-}
-
-lval *
-builtin_mod(lenv *e, lval *a) {
-	return builtin_op(e, a, "%");
-}
-
-lval *
-builtin_gt(lenv *e, lval *a) {
-	return builtin_ord(e, a, ">");
-}
-
-lval *
-builtin_lt(lenv *e, lval *a) {
-	return builtin_ord(e, a, "<");
-}
-
-lval *
-builtin_ge(lenv *e, lval *a) {
-	return builtin_ord(e, a, ">=");
-}
-
-lval *
-builtin_le(lenv *e, lval *a) {
-	return builtin_ord(e, a, "<=");
-}
-
 lval *
 builtin_put(lenv *e, lval *a) {
-	return builtin_var(e, a, "=");
+	return builtin_var(e, a, 0);
 }
 
 lval *builtin_def(lenv *e, lval *a) {
-	return builtin_var(e, a, "def");
+	return builtin_var(e, a, 1);
 }
 
 lval *
@@ -823,6 +1339,13 @@ builtin_lambda(lenv *e, lval *a) {
 			ltype_name(LVAL_SYM));
 	}
 
+	// special forms are syntax, so they cannot be formals either
+	for (int i = 0; i < a->cells[0]->count; i++) {
+		LASSERT(a, !lsym_special(a->cells[0]->cells[i]->val.sym),
+			"Function '\\' cannot redefine special form '%s'.",
+			a->cells[0]->cells[i]->val.sym);
+	}
+
 	// pop first two arguments and pass them to lval_lambda
 	lval *formals = lval_pop(a, 0);
 	lval *body = lval_pop(a, 0);
@@ -831,6 +1354,83 @@ builtin_lambda(lenv *e, lval *a) {
 	return lval_lambda(formals, body);
 }
 
+/*
+ * (loop {vars} {body} values...) evaluates body with vars bound to the
+ * values, like calling (\ {vars} {body}). In the body, (recur values...)
+ * starts it over with new values: in tail position by rebinding the
+ * variables in place, so a loop runs in one frame however long it goes.
+ */
+lval *
+builtin_loop(lenv *e, lval *a) {
+	LASSERT(a, a->count >= 2,
+		"function 'loop' passed incorrect number of arguments. Got %i, expected at least 2.",
+		a->count);
+	LASSERT_TYPE("loop", a, 0, LVAL_QEXPR);
+	LASSERT_TYPE("loop", a, 1, LVAL_QEXPR);
+
+	lval *syms = a->cells[0];
+	for (int i = 0; i < syms->count; i++) {
+		LASSERT(a, syms->cells[i]->type == LVAL_SYM &&
+			strcmp(syms->cells[i]->val.sym, "&") != 0,
+			"function 'loop' cannot bind %s.", syms->cells[i]->type == LVAL_SYM ?
+				"'&'" : ltype_name(syms->cells[i]->type));
+	}
+	for (int i = 0; i < syms->count; i++) {
+		LASSERT(a, !lsym_special(syms->cells[i]->val.sym),
+			"function 'loop' cannot bind special form '%s'.", syms->cells[i]->val.sym);
+	}
+	LASSERT(a, syms->count == a->count - 2,
+		"function 'loop' passed %i values for %i variables.",
+		a->count - 2, syms->count);
+
+	lval *formals = lval_pop(a, 0);
+	lval *body = lval_pop(a, 0);
+	lval *f = lval_lambda(formals, body);
+	f->val.context->chunk = lcompile_loop(e, formals, body);
+	if (!f->val.context->chunk) {
+		lval_del(f);
+		lval_del(a);
+		return lval_err("function 'loop' cannot bind a variable twice.");
+	}
+
+	lval *r = lvm_call(e, f, a);
+	lval_del(f);
+	return r;
+}
+
+// only reached outside the body of a loop, as the VM runs the others
+lval *
+builtin_recur(lenv *e, lval *a) {
+	int n = a->count;
+	lval_del(a);
+	return lval_err("function 'recur' passed %i values outside a loop, "
+		"or not one for each of its variables.", n);
+}
+
+// wraps a lambda so calls with arguments it has seen return the earlier
+// result, keeping at most the optional number of results
+lval *
+builtin_memo(lenv *e, lval *a) {
+	LASSERT(a, a->count == 1 || a->count == 2,
+		"function 'memo' passed incorrect number of arguments. Got %i, expected 1 or 2.",
+		a->count);
+	LASSERT_TYPE("memo", a, 0, LVAL_LAMBDA);
+
+	int limit = 0;
+	if (a->count == 2) {
+		LASSERT_TYPE("memo", a, 1, LVAL_NUM);
+		LASSERT(a, a->cells[1]->val.num > 0 && a->cells[1]->val.num <= INT_MAX,
+			"function 'memo' passed invalid size %li.", a->cells[1]->val.num);
+		limit = a->cells[1]->val.num;
+	}
+
+	lval *f = lval_take(a, 0);
+	lcontext_own(f);
+	lmemo_release(f->val.context->memo);
+	f->val.context->memo = lmemo_new(limit);
+	return f;
+}
+
 lval *
 builtin_list(lenv *e, lval *a) {
 	a->type = LVAL_QEXPR;
@@ -880,40 +1480,103 @@ builtin_load(lenv *e, lval *a) {
 	LASSERT_NUM("load", a, 1);
 	LASSERT_TYPE("load", a, 0, LVAL_STR);
 
-	// parse file given by string name
-	mpc_result_t r;
-	if (!mpc_parse_contents(a->cells[0]->val.str, Lispy, &r)) {
-		char *err_msg = mpc_err_string(r.error);
-		mpc_err_delete(r.error);
-		lval *err = lval_err("Could not load library %s", err_msg);
-		free(err_msg);
-		lval_del(a);
-		return err;
-	}
-
-	// read contents
-	lval *expr = lval_read(r.output);
-	mpc_ast_delete(r.output);
-
-	// evaluate each expression
-	while(expr->count) {
-		lval *x = lval_eval(e, lval_pop(expr, 0));
+	// read file given by string name, or its cache, a form at a time
+	lload_file *f = lload_open(a->cells[0]->val.str);
+	lval_del(a);
 
-		// lval_print(x);
+	// evaluate each expression as it is read
+	for (lval *expr; (expr = lload_next(f)); ) {
+		lval *x = lvm_eval(e, expr);
 
 		// if evaluation produces error, print the error
 		if (x->type == LVAL_ERR) { lval_print(x); }
 		lval_del(x);
 	}
 
-	// delete expressions and arguments
-	lval_del(expr);
-	lval_del(a);
+	// a file that cannot be read stops at the first error in it
+	lval *err = lload_close(f);
+	return err ? err : lval_sexpr();
+}
+
+/*
+ * Source files whose definitions wait until first used, as registered by
+ * 'autoload': the index maps each symbol to the file defining it. Looking
+ * up a symbol nothing binds loads its file into the global environment,
+ * once, and then looks again.
+ */
+static lenv *lautoload_index;
+static lval *lautoload_loaded;
+
+// borrowed value of sym after loading the module that provides it, or NULL
+lval *
+lenv_autoload(lenv *e, char *sym) {
+	lval *path = lautoload_index ? lenv_find(lautoload_index, sym) : NULL;
+	if (!path) { return NULL; }
+	for (int i = 0; i < lautoload_loaded->count; i++) {
+		if (strcmp(lautoload_loaded->cells[i]->val.str, path->val.str) == 0) {
+			return NULL;
+		}
+	}
+	lval_add(lautoload_loaded, lval_copy(path));
+
+	while (e->par) { e = e->par; }
+	lval *x = builtin_load(e, lval_add(lval_sexpr(), lval_copy(path)));
+	if (x->type == LVAL_ERR) { lval_println(x); }
+	lval_del(x);
+	return lenv_find(e, sym);
+}
+
+// a new environment binding each symbol still to be autoloaded to the file
+// that provides it, which images keep for the next run to register again
+lenv *
+lautoload_pending(void) {
+	lenv *p = lenv_new();
+	for (int i = 0; lautoload_index && i < lautoload_index->count; i++) {
+		lval *path = lautoload_index->vals[i];
+		int loaded = 0;
+		for (int j = 0; j < lautoload_loaded->count; j++) {
+			loaded |= strcmp(lautoload_loaded->cells[j]->val.str, path->val.str) == 0;
+		}
+		if (loaded) { continue; }
+		lval *k = lval_sym(lautoload_index->syms[i]);
+		lenv_put(p, k, path);
+		lval_del(k);
+	}
+	return p;
+}
 
-	// return empty list
+lval *
+builtin_autoload(lenv *e, lval *a) {
+	LASSERT_NUM("autoload", a, 2);
+	LASSERT_TYPE("autoload", a, 0, LVAL_STR);
+	LASSERT_TYPE("autoload", a, 1, LVAL_QEXPR);
+	for (int i = 0; i < a->cells[1]->count; i++) {
+		LASSERT(a, a->cells[1]->cells[i]->type == LVAL_SYM,
+			"Function 'autoload' cannot autoload non-symbol. Got %s, expected %s.",
+			ltype_name(a->cells[1]->cells[i]->type), ltype_name(LVAL_SYM));
+	}
+
+	if (!lautoload_index) {
+		lautoload_index = lenv_new();
+		lautoload_loaded = lval_qexpr();
+	}
+	for (int i = 0; i < a->cells[1]->count; i++) {
+		lenv_put(lautoload_index, a->cells[1]->cells[i], a->cells[0]);
+	}
+	lval_del(a);
 	return lval_sexpr();
 }
 
+lval *
+builtin_save_image(lenv *e, lval *a) {
+	LASSERT_NUM("save-image", a, 1);
+	LASSERT_TYPE("save-image", a, 0, LVAL_STR);
+
+	lval *x = limage_save(e, a->cells[0]->val.str);
+	lval_del(a);
+	return x;
+}
+
 lval *
 builtin_print(lenv *e, lval *a) {
 	// print each argument followed by a space
@@ -957,7 +1620,7 @@ lval_eq(lval *x, lval *y) {
 		case LVAL_ERR:
 			return (strcmp(x->val.err, y->val.err) == 0);
 		case LVAL_SYM:
-			return (strcmp(x->val.sym, y->val.sym) == 0);
+			return (x->val.sym == y->val.sym);
 		case LVAL_STR:
 			return (strcmp(x->val.str, y->val.str) == 0);
 		// if builtin, compare function references
@@ -967,6 +1630,23 @@ lval_eq(lval *x, lval *y) {
 		case LVAL_LAMBDA:
 			return lval_eq(x->val.context->formals, y->val.context->formals) &&
 				lval_eq(x->val.context->body, y->val.context->body);
+		case LVAL_PARTIAL: {
+			lpartial *p = x->val.partial, *q = y->val.partial;
+			if (p->bound != q->bound ||
+				!lval_eq(lpartial_fn(p), lpartial_fn(q))) {
+				return 0;
+			}
+			lval *a[p->bound], *b[q->bound];
+			lpartial_args(p, a);
+			lpartial_args(q, b);
+			int eq = 1;
+			for (int i = 0; i < p->bound; i++) {
+				eq = eq && lval_eq(a[i], b[i]);
+				lval_del(a[i]);
+				lval_del(b[i]);
+			}
+			return eq;
+		}
 		// if list, compare every element
 		case LVAL_QEXPR:
 		case LVAL_SEXPR:
@@ -984,30 +1664,6 @@ lval_eq(lval *x, lval *y) {
 	return 0;
 }
 
-lval *
-builtin_cmp(lenv *e, lval *a, char *op) {
-	LASSERT_NUM(op, a, 2);
-	int r;
-	if (strcmp(op, "==") == 0) {
-		r = lval_eq(a->cells[0], a->cells[1]);
-	}
-	if (strcmp(op, "!=") == 0) {
-		r = !lval_eq(a->cells[0], a->cells[1]);
-	}
-	lval_del(a);
-	return lval_num(r);
-}
-
-lval *
-builtin_eq(lenv *e, lval *a) {
-	return builtin_cmp(e, a, "==");
-}
-
-lval *
-builtin_ne(lenv *e, lval *a) {
-	return builtin_cmp(e, a, "!=");
-}
-
 lval *
 builtin_if(lenv *e, lval *a) {
 	LASSERT_NUM("if", a, 3);
@@ -1034,139 +1690,109 @@ builtin_if(lenv *e, lval *a) {
 }
 
 
-lval *
-builtin_op(lenv *e, lval *a, char *op) {
-	// ensure all operands are numbers
-	for(int i = 0; i < a->count; i++) {
-		LASSERT_NUM_TYPE(op, a, i);
+/*
+ * The arithmetic and comparison builtins are generated per operator, so
+ * the loops over their operands contain only the arithmetic: integers are
+ * folded as long until the first float, the rest as double. An integer
+ * result that would overflow a long is promoted to double instead.
+ */
+
+#define LARITH_FAIL(args, msg) { lval_del(args); return lval_err(msg); }
+
+/*
+ * int_step folds operand y into the accumulator x by setting r, and
+ * breaks out to the double loop, y included, when r cannot hold the
+ * result; flt_step folds fy into fx
+ */
+#define LBUILTIN_ARITH(fn, name, negate, int_step, flt_step) \
+	lval * \
+	fn(lenv *e, lval *a) { \
+		LASSERT(a, a->count > 0, \
+			"function '%s' passed no arguments.", name); \
+		for (int i = 0; i < a->count; i++) { \
+			LASSERT_NUM_TYPE(name, a, i); \
+		} \
+		lval **v = a->cells; \
+		int n = a->count, i = 1; \
+		double fx, fy; \
+		if (v[0]->type == LVAL_NUM && !(negate && n == 1 && v[0]->val.num == LONG_MIN)) { \
+			long x = v[0]->val.num, y, r; \
+			if (negate && n == 1) { x = -x; } \
+			for (; i < n && v[i]->type == LVAL_NUM; i++) { \
+				y = v[i]->val.num; \
+				int_step; \
+				x = r; \
+			} \
+			if (i == n) { lval_del(a); return lval_num(x); } \
+			fx = (double) x; \
+		} else { \
+			fx = LVAL_NUMBER_VALUE(v[0]); \
+			if (negate && n == 1) { fx = -fx; } \
+		} \
+		for (; i < n; i++) { \
+			fy = LVAL_NUMBER_VALUE(v[i]); \
+			flt_step; \
+		} \
+		lval_del(a); \
+		return lval_fnum(fx); \
 	}
 
-	lval *x = lval_pop(a, 0);
-
-	// if no arguments and '-', perform unary negation
-	if ((strcmp(op, "-") == 0) && a->count == 0) {
-		if (x->type == LVAL_NUM) {
-			x->val.num = -x->val.num;
-		}
-		if (x->type == LVAL_FNUM) {
-			x->val.fnum = -x->val.fnum;
-		}
+LBUILTIN_ARITH(builtin_add, "+", 0,
+	if (__builtin_add_overflow(x, y, &r)) break,
+	fx += fy)
+LBUILTIN_ARITH(builtin_sub, "-", 1,
+	if (__builtin_sub_overflow(x, y, &r)) break,
+	fx -= fy)
+LBUILTIN_ARITH(builtin_mul, "*", 0,
+	if (__builtin_mul_overflow(x, y, &r)) break,
+	fx *= fy)
+LBUILTIN_ARITH(builtin_div, "/", 0,
+	if (y == 0) LARITH_FAIL(a, "division by zero");
+	if (y == -1 && x == LONG_MIN) break;
+	r = x / y,
+	if (fy == 0) LARITH_FAIL(a, "division by zero"); fx /= fy)
+LBUILTIN_ARITH(builtin_mod, "%", 0,
+	if (y == 0) LARITH_FAIL(a, "division by zero");
+	r = y == -1 ? 0 : x % y,
+	(void) fy; LARITH_FAIL(a, "bad floating point operation"))
+
+#define LBUILTIN_ORD(fn, name, op) \
+	lval * \
+	fn(lenv *e, lval *a) { \
+		LASSERT_NUM(name, a, 2); \
+		LASSERT_NUM_TYPE(name, a, 0); \
+		LASSERT_NUM_TYPE(name, a, 1); \
+		lval *x = a->cells[0], *y = a->cells[1]; \
+		int r; \
+		if (x->type == LVAL_NUM && y->type == LVAL_NUM) { \
+			r = x->val.num op y->val.num; \
+		} else { \
+			r = LVAL_NUMBER_VALUE(x) op LVAL_NUMBER_VALUE(y); \
+		} \
+		lval_del(a); \
+		return lval_num(r); \
 	}
 
-	while(a->count > 0) {
-		lval *y = lval_pop(a, 0);
-
-		if (x->type == LVAL_FNUM || y->type == LVAL_FNUM) {
-			if (x->type == LVAL_NUM) {
-				lval *tmp = lval_fnum((double) x->val.num);
-				tmp->cells = x->cells;
-				tmp->count = x->count;
-				lval_del(x);
-				x = tmp;
-			}
-			if (strcmp(op, "+") == 0) {
-				x->val.fnum = (x->val.fnum + LVAL_NUMBER_VALUE(y));
-			}
-			if (strcmp(op, "-") == 0) {
-				x->val.fnum = (x->val.fnum - LVAL_NUMBER_VALUE(y));
-			}
-			if (strcmp(op, "*") == 0) {
-				x->val.fnum = (x->val.fnum * LVAL_NUMBER_VALUE(y));
-			}
-			if (strcmp(op, "/") == 0) {
-				if (((int)(LVAL_NUMBER_VALUE(y))) == 0) {
-					lval_del(x);
-					lval_del(y);
-					x = lval_err("division by zero");
-					break;
-				}
-				x->val.fnum /= LVAL_NUMBER_VALUE(y);
-			}
-			if (strcmp(op, "%") == 0) {
-				lval_del(x);
-				lval_del(y);
-				x = lval_err("bad floating point operation");
-				break;
-			}
-		} else {
-			if (strcmp(op, "+") == 0) { x->val.num += y->val.num; }
-			if (strcmp(op, "-") == 0) { x->val.num -= y->val.num; }
-			if (strcmp(op, "*") == 0) { x->val.num *= y->val.num; }
-			if (strcmp(op, "/") == 0) { 
-				if (y->val.num == 0) {
-					lval_del(x);
-					lval_del(y);
-					x = lval_err("division by zero");
-					break;
-				}
-				x->val.num /= y->val.num;
-			}
-			if (strcmp(op, "%") == 0) { x->val.num %= y->val.num; }
-		}
-		
-		lval_del(y);
+LBUILTIN_ORD(builtin_gt, ">", >)
+LBUILTIN_ORD(builtin_lt, "<", <)
+LBUILTIN_ORD(builtin_ge, ">=", >=)
+LBUILTIN_ORD(builtin_le, "<=", <=)
+
+#define LBUILTIN_CMP(fn, name, equal) \
+	lval * \
+	fn(lenv *e, lval *a) { \
+		LASSERT_NUM(name, a, 2); \
+		int r = lval_eq(a->cells[0], a->cells[1]) == equal; \
+		lval_del(a); \
+		return lval_num(r); \
 	}
 
-	lval_del(a);
-	return x;
-}
-
-lval *
-builtin_ord(lenv *e, lval *a, char *op) {
-	LASSERT_NUM(op, a, 2);
-	LASSERT_NUM_TYPE(op, a, 0);
-	LASSERT_NUM_TYPE(op, a, 1);
-
-	lval *first = a->cells[0];
-	lval *second = a->cells[1];
-	int r;
-
-	if (first->type == LVAL_FNUM || second->type == LVAL_FNUM) {
-		double firstVal, secondVal;
-		if (first->type == LVAL_NUM) {
-			firstVal = (double) first->val.num;
-		} else {
-			firstVal = first->val.fnum;
-		}
-		if (second->type == LVAL_NUM) {
-			secondVal = (double) second->val.num;
-		} else {
-			secondVal = second->val.fnum;
-		}
-		if (strcmp(op, ">")  == 0) {
-			r = (firstVal > secondVal);
-	  }
-		if (strcmp(op, "<")  == 0) {
-			r = (firstVal < secondVal);
-		}
-		if (strcmp(op, ">=") == 0) {
-			r = (firstVal >= secondVal);
-		}
-		if (strcmp(op, "<=") == 0) {
-			r = (firstVal <= secondVal);
-		}
-	} else {
-		int firstVal = first->val.num, secondVal = second->val.num;
-		if (strcmp(op, ">")  == 0) {
-			r = (firstVal > secondVal);
-	  }
-		if (strcmp(op, "<")  == 0) {
-			r = (firstVal < secondVal);
-		}
-		if (strcmp(op, ">=") == 0) {
-			r = (firstVal >= secondVal);
-		}
-		if (strcmp(op, "<=") == 0) {
-			r = (firstVal <= secondVal);
-		}
-	}
-
-	lval_del(a);
-	return lval_num(r);
-}
+LBUILTIN_CMP(builtin_eq, "==", 1)
+LBUILTIN_CMP(builtin_ne, "!=", 0)
 
 lval *
-builtin_var(lenv *e, lval *a, char *func) {
+builtin_var(lenv *e, lval *a, int global) {
+	char *func = global ? "def" : "=";
 	LASSERT_TYPE(func, a, 0, LVAL_QEXPR);
 
 	// first arg is symbol list
@@ -1190,12 +1816,18 @@ builtin_var(lenv *e, lval *a, char *func) {
 		syms->count,
 		a->count - 1);
 
+	// special forms are syntax, so they cannot be rebound
+	for (int i = 0; i < syms->count; i++) {
+		LASSERT(a, !lsym_special(syms->cells[i]->val.sym),
+			"Function '%s' cannot redefine special form '%s'.",
+			func, syms->cells[i]->val.sym);
+	}
+
 	for (int i = 0; i < syms->count; i++) {
-		// if 'def' define globally, if 'put' define locally
-		if (strcmp(func, "def") == 0) {
+		// if 'def' define globally, if '=' define locally
+		if (global) {
 			lenv_def(e, syms->cells[i], a->cells[i + 1]);
-		}
-		if (strcmp(func, "put") == 0) {
+		} else {
 			lenv_put(e, syms->cells[i], a->cells[i + 1]);
 		}
 	}
@@ -1206,9 +1838,10 @@ builtin_var(lenv *e, lval *a, char *func) {
 
 /* end Builtins */
 
-
-int
-main(int argc, char** argv) {
+// builds the mpc grammar that read.c follows; the interpreter reads without
+// it, and only bench-read builds it, to compare the two
+void
+lparse_init(void) {
 	Number = mpc_new("number");
 	Symbol = mpc_new("symbol");
 	String = mpc_new("string");
@@ -1231,13 +1864,62 @@ main(int argc, char** argv) {
 			lispy   : /^/ <expr>* /$/ ;                        \
 		",
 		Number, Symbol, String, Comment, Sexpr, Qexpr, Expr, Lispy);
+}
+
+void
+lparse_cleanup(void) {
+	mpc_cleanup(8, Number, Symbol, String,
+		Comment, Sexpr, Qexpr, Expr, Lispy);
+}
+
+// lispyc links the runtime into programs with a main of their own
+#ifndef LISPY_NO_MAIN
 
+int
+main(int argc, char** argv) {
 	lenv *e = lenv_new();
 	lenv_add_builtins(e);
 
+	// options come before the files to load
+	int first = 1;
+	for (; first < argc && strncmp(argv[first], "--", 2) == 0; first++) {
+		if (strcmp(argv[first], "--dump-opt") == 0) {
+			lopt_dump = 1;
+		} else if (strcmp(argv[first], "--jit-stats") == 0) {
+			ljit_stats = 1;
+		} else if (strcmp(argv[first], "--alloc-stats") == 0) {
+			lvm_stats = 1;
+		} else if (strcmp(argv[first], "--no-cache") == 0) {
+			lload_cache = 0;
+		} else if (strcmp(argv[first], "--image") == 0 && first + 1 < argc) {
+			lval *x = limage_load(e, argv[++first]);
+			int failed = x->type == LVAL_ERR;
+			if (failed) { lval_println(x); }
+			lval_del(x);
+			if (failed) {
+				lenv_del(e);
+				return 1;
+			}
+		} else if (strcmp(argv[first], "--max-depth") == 0) {
+			char *s = first + 1 < argc ? argv[++first] : "";
+			char *end;
+			errno = 0;
+			long n = strtol(s, &end, 10);
+			if (errno || end == s || *end || n < 1 || n > INT_MAX) {
+				fprintf(stderr, "invalid --max-depth value '%s'\n", s);
+				lenv_del(e);
+				return 1;
+			}
+			lvm_max_depth = n;
+		} else {
+			fprintf(stderr, "Unknown option '%s'\n", argv[first]);
+			return 1;
+		}
+	}
+
 	// read from file
-	if (argc >= 2) {
-		for(int i = 1; i < argc; i++) {
+	if (first < argc) {
+		for(int i = first; i < argc; i++) {
 			lval *args = lval_add(lval_sexpr(), lval_str(argv[i]));
 
 			// pass to builtin load and get result
@@ -1248,33 +1930,33 @@ main(int argc, char** argv) {
 			lval_del(x);
 		}
 	} else { // interactive prompt
-		puts("Lispy Version 0.0.0.0.1");
+		puts("Lispy Version " LISPY_VERSION);
 		puts("Press Ctrl+c to exit\n");	
 
 		while(1) {
 			char *input = readline("lispy> ");
+			if (!input) { break; }
 			add_history(input);
 
-			mpc_result_t r;
-			if(mpc_parse("<stdin>", input, Lispy, &r)) {
-
-				lval *x = lval_eval(e, lval_read(r.output));
+			lval *forms = lread_all("<stdin>", input, strlen(input));
+			if (forms->type != LVAL_ERR) {
+				lval *x = lvm_eval(e, forms);
 				lval_println(x);
 				lval_del(x);
-
-				mpc_ast_delete(r.output);
 			} else {
-				mpc_err_print(r.error);
-				mpc_err_delete(r.error);
+				printf("%s", forms->val.err);
+				lval_del(forms);
 			}
 
 			free(input);
 		}
 	}
 
+ if (ljit_stats) { ljit_report(); }
+ if (lvm_stats) { lvm_report(); }
  lenv_del(e);
 
- mpc_cleanup(8, Number, Symbol, String,
- 	Comment, Sexpr, Qexpr, Expr, Lispy);
  return 0;
-}
\ No newline at end of file
+}
+
+#endif
@@ -3,17 +3,158 @@
 struct lval;
 struct lenv;
 struct lcontext;
+struct lchunk;
+struct lmemo;
+struct lpartial;
 typedef struct lval lval;
 typedef struct lenv lenv;
 typedef struct lcontext lcontext;
+typedef struct lchunk lchunk;
+typedef struct lmemo lmemo;
+typedef struct lpartial lpartial;
 
 typedef lval *(*lbuiltin)(lenv *, lval *);
 
+enum { LVAL_ERR, LVAL_NUM, LVAL_FNUM, LVAL_SYM, LVAL_STR,
+	LVAL_FUN, LVAL_SEXPR, LVAL_QEXPR, LVAL_LAMBDA, LVAL_PARTIAL };
+
+// shared by copies of a lambda until one of them binds arguments
+struct lcontext {
+	int refs;
+	lenv *env;
+	lval *formals;
+	lval *body;
+	lchunk *chunk;
+	// results of earlier calls, for lambdas wrapped by 'memo'
+	lmemo *memo;
+};
+
+/*
+ * A lambda applied to fewer arguments than it has formals. Nothing is
+ * bound until the remaining arguments arrive, and as it never changes,
+ * copies share it. Applying one to more, but still too few, arguments
+ * links a new one to it rather than copying it.
+ */
+struct lpartial {
+	int refs;
+	// the lambda, held by the first link only
+	lval *fn;
+	lpartial *up;
+	// arguments given to this link, and to the whole chain
+	int count;
+	int bound;
+	lval **args;
+};
+
+typedef union {
+	long num;
+	double fnum;
+	char *sym;
+	char *str;
+	char *err;
+	lbuiltin builtin;
+	lcontext *context;
+	lpartial *partial;
+} nval;
+
+struct lval {
+	int type;
+	nval val;
+	int count;
+	struct lval **cells;
+};
+
+struct lenv {
+	lenv *par;
+	int count;
+	// set when syms/vals belong to a VM frame and must be copied before growing
+	int borrowed;
+	char **syms;
+	lval **vals;
+	// stamp of each binding, renewed whenever it is rebound; NULL while
+	// borrowed, since only globals are checked against it
+	unsigned *vers;
+};
+
+#define LVAL_NUMBER_VALUE(x) ((*x).type == LVAL_FNUM ? (*x).val.fnum : (*x).val.num)
+
+char *lsym_intern(const char *, size_t);
+int lsym_special(char *);
+
+// whether sym has ever been bound in a scope other than the global one,
+// recorded in a byte ahead of the name
+#define LSYM_LOCAL(sym) ((sym)[-1])
+
+extern long lval_allocs;
+lval *lval_err(char *, ...);
+lval *lval_num(long);
+lval *lval_fnum(double);
+lval *lval_sym(char *);
+lval *lval_symn(const char *, size_t);
+lval *lval_str(char *);
+lval *lval_strn(const char *, size_t);
+lval *lval_sexpr(void);
+lval *lval_qexpr(void);
+lval *lval_fun(lbuiltin);
+lval *lval_lambda(lval *, lval *);
+lval *lval_partial(lval *, lval *);
+
+lval *lpartial_fn(lpartial *);
+void lpartial_args(lpartial *, lval **);
+int lval_needs(lval *);
+int lval_variadic(lval *);
+
+#define LISPY_VERSION "0.0.0.0.1"
+
+// the mpc grammar of source files, which only bench-read builds now
+extern mpc_parser_t *Lispy;
+void lparse_init(void);
+void lparse_cleanup(void);
+
+/*
+ * Reads source text into values, one top-level form at a time. A syntax
+ * error stops it; numbers out of range read as error values instead.
+ */
+typedef struct lreader {
+	const char *name;
+	const char *at;
+	const char *end;
+	// line number and start of the line at, for errors, and the column
+	// bol is at when the line began before the buffer did
+	int line;
+	const char *bol;
+	long col;
+	int failed;
+	// the stream a buffer of cap bytes is refilled from, if any
+	FILE *in;
+	char *buf;
+	size_t cap;
+} lreader;
+
+void lreader_init(lreader *, const char *, const char *, size_t);
+void lreader_open(lreader *, const char *, FILE *);
+void lreader_close(lreader *);
+lval *lread_next(lreader *);
+lval *lread_all(const char *, const char *, size_t);
+
+// forms read from a source file, or from the cache beside it, one at a
+// time; lload_close gives back the error that stopped them, if any
+typedef struct lload_file lload_file;
+extern int lload_cache;
+lload_file *lload_open(char *);
+lval *lload_next(lload_file *);
+lval *lload_close(lload_file *);
+lval *lload_forms(char *);
+
+// the global bindings and pending autoloads, saved by 'save-image' and
+// restored by --image
+lval *limage_save(lenv *, char *);
+lval *limage_load(lenv *, char *);
+
 lval *lval_read_num(mpc_ast_t *);
 lval *lval_read_str(mpc_ast_t *);
 lval *lval_read(mpc_ast_t *);
 lval *lval_add(lval*, lval *);
-lval *lval_eval_sexpr(lenv *, lval *);
 lval *lval_eval(lenv *, lval *);
 lval *lval_pop(lval *, int);
 lval *lval_take(lval *, int);
@@ -44,11 +185,14 @@ lval *builtin_lambda(lenv *, lval *);
 lval *builtin_def(lenv *, lval *);
 lval *builtin_put(lenv *, lval *);
 
-lval *builtin_var(lenv *, lval *, char *);
-lval *builtin_op(lenv *, lval *, char*);
-lval *builtin_ord(lenv *, lval *, char *);
-lval *builtin_cmp(lenv *, lval *, char *);
+lval *builtin_memo(lenv *, lval *);
+lval *builtin_loop(lenv *, lval *);
+lval *builtin_recur(lenv *, lval *);
+
+lval *builtin_var(lenv *, lval *, int);
 lval *builtin_load(lenv *, lval *);
+lval *builtin_autoload(lenv *, lval *);
+lval *builtin_save_image(lenv *, lval *);
 lval *builtin_print(lenv *, lval *);
 lval *builtin_error(lenv *, lval *);
 
@@ -60,14 +204,31 @@ void lval_print_str(lval *);
 
 char *ltype_name(int);
 
+lenv *lenv_new(void);
+void lenv_del(lenv *);
 lval *lenv_get(lenv *, lval *);
+lval *lenv_find(lenv *, char *);
+lval *lenv_autoload(lenv *, char *);
+lenv *lautoload_pending(void);
+void lenv_own(lenv *);
 void lenv_put(lenv *, lval *, lval *);
 lenv *lenv_copy(lenv *);
+void lenv_def(lenv *, lval *, lval *);
 void lenv_add_builtin(lenv *, char *, lbuiltin);
 void lenv_add_builtins(lenv *);
+void lenv_carry(lenv *, lenv *);
 lval *lval_call(lenv *, lval *, lval *);
+lval *lval_bind(lenv *, lval *, lval *);
+lval *lval_tail(lval *, lval *);
 
 int lval_eq(lval *, lval *);
 
+lmemo *lmemo_new(int);
+int lmemo_limit(lmemo *);
+lmemo *lmemo_retain(lmemo *);
+void lmemo_release(lmemo *);
+lval *lmemo_get(lmemo *, lval **, int);
+void lmemo_put(lmemo *, lval *, lval *);
+
 #define __LISPY_H 1
-#endif
\ No newline at end of file
+#endif
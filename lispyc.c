@@ -0,0 +1,469 @@
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+/*
+ * Ahead-of-time compiler from a lispy source file to C. The program it
+ * emits links against the runtime and evaluates the file's forms in
+ * order, exactly as `lispy file.lspy` would, but with the reading done
+ * ahead of time: each form is built by a constructor instead of parsed.
+ *
+ * Lambdas bound by top-level forms like (def {fib} (\ {n} {...})) are
+ * compiled here as the VM would compile them. Those the JIT could
+ * translate, integer arithmetic and calls of themselves, become C
+ * functions, which the program hands to ljit_adopt once the form that
+ * defines them has run. They only take over if the lambda compiled to the
+ * same bytecode at runtime, and under the same checks as JIT code;
+ * everything else runs in the VM.
+ *
+ * Usage: lispyc file.lspy > file.c
+ */
+
+/* Values */
+
+// whether v can be rebuilt by emitted code
+static int
+lispyc_literal(lval *v) {
+	switch (v->type) {
+		case LVAL_NUM:
+		case LVAL_FNUM:
+		case LVAL_SYM:
+		case LVAL_STR:
+		case LVAL_ERR:
+			return 1;
+		case LVAL_LAMBDA:
+			return !v->val.context->env->count &&
+				lispyc_literal(v->val.context->formals) &&
+				lispyc_literal(v->val.context->body);
+		case LVAL_SEXPR:
+		case LVAL_QEXPR:
+			for (int i = 0; i < v->count; i++) {
+				if (!lispyc_literal(v->cells[i])) { return 0; }
+			}
+			return 1;
+	}
+	return 0;
+}
+
+// a C string literal; octal escapes keep it clear of trigraphs too
+static void
+lispyc_string(FILE *out, char *s) {
+	fputc('"', out);
+	for (; *s; s++) {
+		unsigned char ch = *s;
+		if (ch < ' ' || ch > '~' || ch == '"' || ch == '\\' || ch == '?') {
+			fprintf(out, "\\%03o", ch);
+		} else {
+			fputc(ch, out);
+		}
+	}
+	fputc('"', out);
+}
+
+// an expression that builds a copy of v, which lispyc_literal accepted
+static void
+lispyc_value(FILE *out, lval *v) {
+	switch (v->type) {
+		case LVAL_NUM:
+			if (v->val.num == LONG_MIN) {
+				fprintf(out, "lval_num(LONG_MIN)");
+			} else {
+				fprintf(out, "lval_num(%ldL)", v->val.num);
+			}
+			return;
+		case LVAL_FNUM:
+			// hexadecimal floats are exact
+			fprintf(out, "lval_fnum(%a)", v->val.fnum);
+			return;
+		case LVAL_SYM:
+			fprintf(out, "lval_sym(");
+			lispyc_string(out, v->val.sym);
+			fprintf(out, ")");
+			return;
+		case LVAL_STR:
+			fprintf(out, "lval_str(");
+			lispyc_string(out, v->val.str);
+			fprintf(out, ")");
+			return;
+		case LVAL_ERR:
+			fprintf(out, "lval_err(\"%%s\", ");
+			lispyc_string(out, v->val.err);
+			fprintf(out, ")");
+			return;
+		case LVAL_LAMBDA:
+			fprintf(out, "lval_lambda(");
+			lispyc_value(out, v->val.context->formals);
+			fprintf(out, ", ");
+			lispyc_value(out, v->val.context->body);
+			fprintf(out, ")");
+			return;
+		case LVAL_SEXPR:
+		case LVAL_QEXPR:
+			if (!v->count) {
+				fprintf(out, v->type == LVAL_SEXPR ? "lval_sexpr()" : "lval_qexpr()");
+				return;
+			}
+			fprintf(out, "lispyc_list(%s, %i",
+				v->type == LVAL_SEXPR ? "lval_sexpr()" : "lval_qexpr()", v->count);
+			for (int i = 0; i < v->count; i++) {
+				fprintf(out, ", ");
+				lispyc_value(out, v->cells[i]);
+			}
+			fprintf(out, ")");
+			return;
+	}
+}
+
+/* Native functions */
+
+// one lambda translated to C, for the form that binds it
+typedef struct lispyc_fn {
+	int id;
+	int form;
+	char *name;
+	lchunk *c;
+} lispyc_fn;
+
+// z = x op y, leaving anything the VM would not get the same answer for
+static void
+lispyc_arith(FILE *out, int op, char *x, char *y, char *z) {
+	static const char *compare[ARITH_COUNT] = {
+		[ARITH_GT] = ">", [ARITH_LT] = "<", [ARITH_GE] = ">=",
+		[ARITH_LE] = "<=", [ARITH_EQ] = "==", [ARITH_NE] = "!="
+	};
+
+	switch (op) {
+		case ARITH_ADD:
+		case ARITH_SUB:
+		case ARITH_MUL:
+			fprintf(out, "\tif (__builtin_%s_overflow(%s, %s, &%s)) { goto bail; }\n",
+				op == ARITH_ADD ? "add" : op == ARITH_SUB ? "sub" : "mul", x, y, z);
+			return;
+		case ARITH_DIV:
+		case ARITH_MOD:
+			fprintf(out, "\tif (%s == 0 || %s == -1) { goto bail; }\n", y, y);
+			fprintf(out, "\t%s = %s %c %s;\n", z, x, op == ARITH_DIV ? '/' : '%', y);
+			return;
+		default:
+			fprintf(out, "\t%s = %s %s %s;\n", z, x, compare[op], y);
+			return;
+	}
+}
+
+// a call of f with the n values on top of the stack at depth d
+static void
+lispyc_call(FILE *out, lispyc_fn *f, int n, int d) {
+	fprintf(out, "\t{\n\t\tlong a[%i] = {", n ? n : 1);
+	for (int i = 0; i < n; i++) {
+		fprintf(out, "%s s%i", i ? "," : "", d - 1 - i);
+	}
+	fprintf(out, "%s };\n", n ? "" : " 0");
+	fprintf(out, "\t\tif (!lispyc_fn%i(&a[%i], &s%i)) { goto bail; }\n\t}\n",
+		f->id, n ? n - 1 : 0, d - n);
+}
+
+/*
+ * Translates the code of f that reach marks. Values on the operand stack
+ * become variables named after their depth, which is the same on every
+ * path to an instruction since the compiler only jumps forward.
+ */
+static int
+lispyc_translate(FILE *out, lispyc_fn *f, char *reach) {
+	lchunk *c = f->c;
+	int *depth = malloc(sizeof(int) * (c->count + 1));
+	char *label = calloc(c->count + 1, 1);
+	for (int pc = 0; pc <= c->count; pc++) { depth[pc] = -1; }
+	depth[0] = 0;
+
+	int max = 0, bails = 0, tails = 0, tests = 0;
+	for (int pc = 0; pc < c->count; pc += 1 + lop_operands[c->code[pc]]) {
+		if (!reach[pc]) { continue; }
+		int *op = &c->code[pc + 1];
+		int next = pc + 1 + lop_operands[c->code[pc]];
+		int d = depth[pc];
+		if (d < 0) { goto fail; }
+
+		// successors, with the depth each starts at, and whether the
+		// first one is reached by falling through
+		int to[2], at[2], nto = 0, falls = 0;
+		switch (c->code[pc]) {
+			case OP_CONST:
+			case OP_LOCAL:
+				to[nto] = next; at[nto++] = d + 1; falls = 1;
+				break;
+			case OP_POP:
+				to[nto] = next; at[nto++] = d - 1; falls = 1;
+				break;
+			case OP_ARITH:
+				to[nto] = next; at[nto++] = d - 1; falls = 1; bails = 1;
+				break;
+			case OP_GUARD:
+				to[nto] = next; at[nto++] = d; falls = 1;
+				break;
+			case OP_ARITH_LL:
+			case OP_ARITH_LK:
+				to[nto] = op[5]; at[nto++] = d + 1; bails = 1;
+				break;
+			case OP_IF_LL:
+			case OP_IF_LK:
+				to[nto] = op[5]; at[nto++] = d;
+				to[nto] = op[6]; at[nto++] = d;
+				bails = tests = 1;
+				break;
+			case OP_IF:
+				to[nto] = next; at[nto++] = d - 1; falls = 1;
+				to[nto] = op[0]; at[nto++] = d - 1;
+				break;
+			case OP_JUMP:
+				to[nto] = op[0]; at[nto++] = d;
+				break;
+			case OP_RETURN:
+				break;
+			case OP_CALLSYM:
+				to[nto] = next; at[nto++] = d - op[2] + 1; falls = 1; bails = 1;
+				break;
+			case OP_RECUR:
+				if (!op[1]) {
+					to[nto] = next; at[nto++] = d - op[0] + 1; falls = 1; bails = 1;
+				} else {
+					tails = 1;
+				}
+				break;
+			case OP_TCALLSYM:
+				tails = 1;
+				break;
+		}
+		// the variables written, at depth d for all that push
+		int pushes = nto && at[0] > d;
+		if (d + pushes > max) { max = d + pushes; }
+		for (int i = 0; i < nto; i++) {
+			if (to[i] <= pc || (depth[to[i]] >= 0 && depth[to[i]] != at[i])) {
+				goto fail;
+			}
+			depth[to[i]] = at[i];
+			if (i || !falls) { label[to[i]] = 1; }
+		}
+	}
+
+	fprintf(out, "\n// %s\nstatic int\nlispyc_fn%i(long *l, long *out) {\n",
+		f->name, f->id);
+	for (int i = 0; i < max; i++) {
+		fprintf(out, "\tlong s%i;\n", i);
+	}
+	if (tests) { fprintf(out, "\tlong t;\n"); }
+	fprintf(out, "\tif (ljit_depth >= LJIT_DEPTH) { return 0; }\n");
+	fprintf(out, "\tljit_depth++;\n");
+	if (tails) { fprintf(out, "body:\n"); }
+
+	char x[32], y[32], z[32];
+	for (int pc = 0; pc < c->count; pc += 1 + lop_operands[c->code[pc]]) {
+		if (!reach[pc]) { continue; }
+		if (label[pc]) { fprintf(out, "L%i:\n", pc); }
+		int *op = &c->code[pc + 1];
+		int d = depth[pc];
+
+		switch (c->code[pc]) {
+			case OP_CONST:
+				fprintf(out, "\ts%i = %ldL;\n", d, c->consts[op[0]]->val.num);
+				break;
+			case OP_LOCAL:
+				fprintf(out, "\ts%i = l[-%i];\n", d, op[0]);
+				break;
+			case OP_ARITH:
+				sprintf(x, "s%i", d - 2);
+				sprintf(y, "s%i", d - 1);
+				lispyc_arith(out, op[0], x, y, x);
+				break;
+			case OP_ARITH_LL:
+			case OP_ARITH_LK:
+			case OP_IF_LL:
+			case OP_IF_LK:
+				sprintf(x, "l[-%i]", op[1]);
+				if (c->code[pc] == OP_ARITH_LL || c->code[pc] == OP_IF_LL) {
+					sprintf(y, "l[-%i]", op[2]);
+				} else {
+					sprintf(y, "%ldL", c->consts[op[2]]->val.num);
+				}
+				if (c->code[pc] == OP_ARITH_LL || c->code[pc] == OP_ARITH_LK) {
+					sprintf(z, "s%i", d);
+					lispyc_arith(out, op[0], x, y, z);
+					fprintf(out, "\tgoto L%i;\n", op[5]);
+				} else {
+					lispyc_arith(out, op[0], x, y, "t");
+					fprintf(out, "\tif (t) { goto L%i; }\n\tgoto L%i;\n", op[5], op[6]);
+				}
+				break;
+			case OP_IF:
+				fprintf(out, "\tif (!s%i) { goto L%i; }\n", d - 1, op[0]);
+				break;
+			case OP_JUMP:
+				fprintf(out, "\tgoto L%i;\n", op[0]);
+				break;
+			case OP_RETURN:
+				fprintf(out, "\t*out = s%i;\n\tljit_depth--;\n\treturn 1;\n", d - 1);
+				break;
+			case OP_CALLSYM:
+			case OP_TCALLSYM:
+			case OP_RECUR: {
+				int n = c->code[pc] == OP_RECUR ? op[0] : op[2];
+				if (c->code[pc] == OP_CALLSYM || (c->code[pc] == OP_RECUR && !op[1])) {
+					lispyc_call(out, f, n, d);
+					break;
+				}
+				// the arguments replace the locals, then the body starts over
+				for (int i = 0; i < n; i++) {
+					fprintf(out, "\tl[-%i] = s%i;\n", i, d - n + i);
+				}
+				fprintf(out, "\tgoto body;\n");
+				break;
+			}
+		}
+	}
+
+	if (bails) { fprintf(out, "bail:\n\tljit_depth--;\n\treturn 0;\n"); }
+	fprintf(out, "}\n");
+	free(depth);
+	free(label);
+	return 1;
+
+fail:
+	free(depth);
+	free(label);
+	return 0;
+}
+
+// the code and constants the function must have been translated from
+static void
+lispyc_source(FILE *out, lispyc_fn *f) {
+	lchunk *c = f->c;
+	fprintf(out, "\nstatic const int lispyc_code%i[] = {", f->id);
+	for (int i = 0; i < c->count; i++) {
+		fprintf(out, "%s%s%i", i ? "," : "", i % 16 ? " " : "\n\t", c->code[i]);
+	}
+	fprintf(out, "\n};\n");
+
+	fprintf(out, "\nstatic lval *\nlispyc_consts%i(void) {\n\treturn ", f->id);
+	lval *consts = lval_qexpr();
+	for (int i = 0; i < c->nconsts; i++) {
+		lval_add(consts, c->consts[i]);
+	}
+	lispyc_value(out, consts);
+	consts->count = 0;
+	lval_del(consts);
+	fprintf(out, ";\n}\n");
+}
+
+/*
+ * Compiles form as the VM will when it comes to run it, binding the
+ * lambdas it defines if it only defines literal lambdas. Each one that
+ * can be translated is added to fns.
+ */
+static void
+lispyc_form(lenv *e, lval *form, int index, lispyc_fn **fns, int *nfns) {
+	lchunk *c = lcompile_expr(e, form);
+
+	// CONST k (n times), DEF k n, RETURN
+	int n = 0, pc = 0;
+	while (pc < c->count && c->code[pc] == OP_CONST) {
+		pc += 2;
+		n++;
+	}
+	if (n && pc + 4 == c->count && c->code[pc] == OP_DEF && c->code[pc + 2] == n) {
+		lval *syms = c->consts[c->code[pc + 1]];
+		for (int i = 0; i < n; i++) {
+			lval *f = c->consts[c->code[2 * i + 1]];
+			lenv_def(e, syms->cells[i], f);
+		}
+
+		for (int i = 0; i < n; i++) {
+			lval *f = c->consts[c->code[2 * i + 1]];
+			if (f->type != LVAL_LAMBDA || !f->val.context->chunk) { continue; }
+			lchunk *body = f->val.context->chunk;
+			char *reach = calloc(body->count + 1, 1);
+			int consts = 1;
+			for (int k = 0; k < body->nconsts; k++) {
+				consts = consts && lispyc_literal(body->consts[k]);
+			}
+			if (consts && ljit_plan(e, body, reach)) {
+				lispyc_fn *fn = &(*fns)[*nfns];
+				fn->id = *nfns;
+				fn->form = index;
+				fn->name = syms->cells[i]->val.sym;
+				fn->c = lchunk_retain(body);
+				if (lispyc_translate(stdout, fn, reach)) {
+					lispyc_source(stdout, fn);
+					(*nfns)++;
+					*fns = realloc(*fns, sizeof(lispyc_fn) * (*nfns + 1));
+				} else {
+					lchunk_release(body);
+				}
+			}
+			free(reach);
+		}
+	}
+	lchunk_release(c);
+}
+
+int
+main(int argc, char **argv) {
+	if (argc != 2) {
+		fprintf(stderr, "Usage: lispyc file.lspy > file.c\n");
+		return 1;
+	}
+
+	lval *forms = lload_forms(argv[1]);
+	if (forms->type == LVAL_ERR) {
+		fprintf(stderr, "%s\n", forms->val.err);
+		lval_del(forms);
+		return 1;
+	}
+
+	printf("// generated by lispyc from ");
+	lispyc_string(stdout, argv[1]);
+	printf("\n\n#include <limits.h>\n#include <stdarg.h>\n#include <stdint.h>\n#include <stdio.h>\n\n");
+	printf("#include \"mpc/mpc.h\"\n#include \"lispy.h\"\n#include \"vm.h\"\n\n");
+	printf("static lval *\nlispyc_list(lval *x, int n, ...) {\n");
+	printf("\tva_list ap;\n\tva_start(ap, n);\n");
+	printf("\tfor (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }\n");
+	printf("\tva_end(ap);\n\treturn x;\n}\n");
+
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lispyc_fn *fns = malloc(sizeof(lispyc_fn));
+	int nfns = 0;
+	for (int i = 0; i < forms->count; i++) {
+		lispyc_form(e, forms->cells[i], i, &fns, &nfns);
+		printf("\nstatic lval *\nlispyc_form%i(void) {\n\treturn ", i);
+		lispyc_value(stdout, forms->cells[i]);
+		printf(";\n}\n");
+	}
+
+	printf("\nint\nmain(void) {\n");
+	printf("\tlenv *e = lenv_new();\n\tlenv_add_builtins(e);\n");
+	printf("\tlval *x;\n");
+	for (int i = 0, j = 0; i < forms->count; i++) {
+		printf("\n\tx = lvm_eval(e, lispyc_form%i());\n", i);
+		printf("\tif (x->type == LVAL_ERR) { lval_print(x); }\n\tlval_del(x);\n");
+		for (; j < nfns && fns[j].form == i; j++) {
+			printf("\tljit_adopt(e, ");
+			lispyc_string(stdout, fns[j].name);
+			printf(", lispyc_code%i, %i, lispyc_consts%i(), lispyc_fn%i);\n",
+				j, fns[j].c->count, j, j);
+		}
+	}
+	printf("\n\tlenv_del(e);\n\treturn 0;\n}\n");
+
+	for (int i = 0; i < nfns; i++) {
+		lchunk_release(fns[i].c);
+	}
+	free(fns);
+	lval_del(forms);
+	lenv_del(e);
+	return 0;
+}
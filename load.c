@@ -0,0 +1,684 @@
+#define _DEFAULT_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+
+/*
+ * Reading source files for 'load'. The forms read from path are kept in
+ * a cache file beside it, path with a trailing 'c', which later loads read
+ * instead of parsing the source again as long as its size and modification
+ * time, and the interpreter version, are still those the cache was made
+ * for. A cache that cannot be read or written is ignored.
+ *
+ * The cache holds the forms as the reader made them: a header, then each
+ * form in turn, as a type byte followed by its number, its length and
+ * bytes, or its count and cells, in the byte order of the machine that
+ * wrote it. Both the source and the cache are read a form at a time, and
+ * the cache written as the source is read, so a load of any size needs
+ * only as much memory as its largest form.
+ *
+ * Images written by 'save-image' use the same encoding for the global
+ * bindings, which may also hold builtins, recorded by name, lambdas with
+ * their bound arguments and partial applications, and then for the
+ * autoloads not yet loaded, each symbol bound to the file providing it.
+ * Being free of pointers they can be mapped anywhere, and --image rebuilds
+ * the bindings from the mapping without parsing or evaluating anything.
+ */
+
+int lload_cache = 1;
+
+#define LLOAD_MAGIC "lspyc"
+#define LLOAD_IMAGE "lspyi"
+// changes whenever the layout below does, or the reader reads the same
+// source differently, as then old caches hold forms it no longer makes
+#define LLOAD_FORMAT 5
+
+typedef struct lload_header {
+	char magic[8];
+	uint32_t format;
+	uint32_t order;
+	char version[16];
+	int64_t size;
+	int64_t mtime;
+	int64_t mtime_ns;
+} lload_header;
+
+// the header of a cache for the source st describes, or of an image
+static void
+lload_key(lload_header *h, struct stat *st) {
+	memset(h, 0, sizeof(*h));
+	strcpy(h->magic, st ? LLOAD_MAGIC : LLOAD_IMAGE);
+	h->format = LLOAD_FORMAT;
+	h->order = 0x01020304;
+	strncpy(h->version, LISPY_VERSION, sizeof(h->version) - 1);
+	if (!st) { return; }
+	h->size = st->st_size;
+	h->mtime = st->st_mtime;
+#ifdef __linux__
+	h->mtime_ns = st->st_mtim.tv_nsec;
+#endif
+}
+
+// the name b is bound to in the fresh environment builtins, or NULL
+static char *
+lload_builtin_name(lenv *builtins, lbuiltin b) {
+	for (int i = 0; builtins && i < builtins->count; i++) {
+		if (builtins->vals[i]->val.builtin == b) { return builtins->syms[i]; }
+	}
+	return NULL;
+}
+
+static char *
+lload_cache_path(char *path) {
+	char *p = malloc(strlen(path) + 2);
+	strcpy(p, path);
+	strcat(p, "c");
+	return p;
+}
+
+/* Writing */
+
+static void
+lload_put_u32(FILE *f, uint32_t n) {
+	fwrite(&n, sizeof(n), 1, f);
+}
+
+static void
+lload_put_str(FILE *f, char *s) {
+	uint32_t len = strlen(s) + 1;
+	lload_put_u32(f, len);
+	fwrite(s, 1, len, f);
+}
+
+static int lload_put_env(FILE *, lenv *, lenv *, int);
+static int lload_put_list(FILE *, lval *, lenv *);
+
+// writes v, returning 0 if it holds a builtin not named in builtins
+static int
+lload_put(FILE *f, lval *v, lenv *builtins) {
+	unsigned char type = v->type;
+	fwrite(&type, 1, 1, f);
+	switch (v->type) {
+		case LVAL_NUM: {
+			int64_t n = v->val.num;
+			fwrite(&n, sizeof(n), 1, f);
+			return 1;
+		}
+		case LVAL_FNUM:
+			fwrite(&v->val.fnum, sizeof(double), 1, f);
+			return 1;
+		case LVAL_SYM:
+			lload_put_str(f, v->val.sym);
+			return 1;
+		case LVAL_STR:
+			lload_put_str(f, v->val.str);
+			return 1;
+		case LVAL_ERR:
+			lload_put_str(f, v->val.err);
+			return 1;
+		case LVAL_FUN: {
+			char *name = lload_builtin_name(builtins, v->val.builtin);
+			if (!name) { return 0; }
+			lload_put_str(f, name);
+			return 1;
+		}
+		case LVAL_LAMBDA: {
+			lcontext *c = v->val.context;
+			lload_put_u32(f, c->memo ? (uint32_t) lmemo_limit(c->memo) : UINT32_MAX);
+			return lload_put_env(f, c->env, builtins, 0) &&
+				lload_put(f, c->formals, builtins) && lload_put(f, c->body, builtins);
+		}
+		case LVAL_PARTIAL: {
+			lpartial *p = v->val.partial;
+			lval **args = malloc(sizeof(lval *) * p->bound);
+			lpartial_args(p, args);
+			int ok = lload_put(f, lpartial_fn(p), builtins);
+			lload_put_u32(f, p->bound);
+			for (int i = 0; i < p->bound; i++) {
+				ok = ok && lload_put(f, args[i], builtins);
+				lval_del(args[i]);
+			}
+			free(args);
+			return ok;
+		}
+		default:
+			return lload_put_list(f, v, builtins);
+	}
+}
+
+// writes the cells of the list v, keeping the lists it is inside of on a
+// stack of its own, as forms may nest deeper than the C stack goes
+static int
+lload_put_list(FILE *f, lval *v, lenv *builtins) {
+	struct { lval *v; int i; } *open = malloc(sizeof(*open) * 16);
+	int depth = 1, cap = 16, ok = 1;
+	open[0].v = v;
+	open[0].i = 0;
+	lload_put_u32(f, v->count);
+	while (ok && depth) {
+		lval *x = open[depth - 1].v;
+		if (open[depth - 1].i == x->count) {
+			depth--;
+			continue;
+		}
+		x = x->cells[open[depth - 1].i++];
+		if (x->type != LVAL_SEXPR && x->type != LVAL_QEXPR) {
+			ok = lload_put(f, x, builtins);
+			continue;
+		}
+		unsigned char type = x->type;
+		fwrite(&type, 1, 1, f);
+		lload_put_u32(f, x->count);
+		if (depth == cap) { open = realloc(open, sizeof(*open) * (cap *= 2)); }
+		open[depth].v = x;
+		open[depth++].i = 0;
+	}
+	free(open);
+	return ok;
+}
+
+// writes the bindings of e, leaving out builtins still bound to their
+// own names when globals is set
+static int
+lload_put_env(FILE *f, lenv *e, lenv *builtins, int globals) {
+	uint32_t count = 0;
+	for (int i = 0; i < e->count; i++) {
+		lval *v = e->vals[i];
+		count += !(globals && v->type == LVAL_FUN &&
+			lload_builtin_name(builtins, v->val.builtin) == e->syms[i]);
+	}
+	lload_put_u32(f, count);
+	for (int i = 0; i < e->count; i++) {
+		lval *v = e->vals[i];
+		if (globals && v->type == LVAL_FUN &&
+			lload_builtin_name(builtins, v->val.builtin) == e->syms[i]) {
+			continue;
+		}
+		lload_put_str(f, e->syms[i]);
+		if (!lload_put(f, v, builtins)) { return 0; }
+	}
+	return 1;
+}
+
+/*
+ * Starts a cache for the source that st describes, or an image if st is
+ * NULL, at path. It is written aside, at the name left in tmp, and renamed
+ * by lload_finish, so readers never see half a file.
+ */
+static FILE *
+lload_begin(char *path, struct stat *st, char **tmp) {
+	// a load may read the file it is in, so the pid alone is not enough
+	static int files;
+	*tmp = malloc(strlen(path) + 32);
+	sprintf(*tmp, "%s.%ld.%i", path, (long) getpid(), files++);
+	FILE *f = fopen(*tmp, "wb");
+	if (!f) {
+		free(*tmp);
+		return NULL;
+	}
+	lload_header h;
+	lload_key(&h, st);
+	fwrite(&h, sizeof(h), 1, f);
+	return f;
+}
+
+// moves what f holds to path if ok, and returns whether it did
+static int
+lload_finish(FILE *f, char *tmp, char *path, int ok) {
+	ok = !ferror(f) && ok;
+	ok = fclose(f) == 0 && ok && rename(tmp, path) == 0;
+	if (!ok) { remove(tmp); }
+	free(tmp);
+	return ok;
+}
+
+/* Reading */
+
+typedef struct lload_buf {
+	char *at;
+	char *end;
+	// the file a buffer of cap bytes at data is refilled from, when the
+	// whole of it is not mapped
+	FILE *f;
+	char *data;
+	size_t cap;
+} lload_buf;
+
+// whether n bytes are left at b->at, once as much of the file as fits
+// has been read in
+static int
+lload_fill(lload_buf *b, size_t n) {
+	size_t keep = b->end - b->at;
+	if (keep >= n || !b->f) { return keep >= n; }
+	memmove(b->data, b->at, keep);
+	if (n > b->cap) {
+		char *data = realloc(b->data, n);
+		if (!data) { return 0; }
+		b->data = data;
+		b->cap = n;
+	}
+	b->at = b->data;
+	b->end = b->data + keep;
+	b->end += fread(b->end, 1, b->cap - keep, b->f);
+	return (size_t) (b->end - b->at) >= n;
+}
+
+static int
+lload_take(lload_buf *b, void *out, size_t n) {
+	if (!lload_fill(b, n)) { return 0; }
+	memcpy(out, b->at, n);
+	b->at += n;
+	return 1;
+}
+
+// the next string in b, which stays in it until the next take, or NULL
+static char *
+lload_take_str(lload_buf *b) {
+	uint32_t len;
+	if (!lload_take(b, &len, sizeof(len)) || !len ||
+		!lload_fill(b, len) || b->at[len - 1]) {
+		return NULL;
+	}
+	char *s = b->at;
+	b->at += len;
+	return s;
+}
+
+static lval *lload_get(lload_buf *, lenv *);
+static lval *lload_get_list(lload_buf *, unsigned char, lenv *);
+
+// reads bindings into e, returning 0 if the file is damaged
+static int
+lload_get_env(lload_buf *b, lenv *e, lenv *builtins) {
+	uint32_t count;
+	if (!lload_take(b, &count, sizeof(count))) { return 0; }
+	for (uint32_t i = 0; i < count; i++) {
+		char *sym = lload_take_str(b);
+		if (!sym) { return 0; }
+		lval *k = lval_sym(sym);
+		lval *v = lload_get(b, builtins);
+		if (!v) {
+			lval_del(k);
+			return 0;
+		}
+		lenv_put(e, k, v);
+		lval_del(k);
+		lval_del(v);
+	}
+	return 1;
+}
+
+// the next value in b, or NULL if the file is damaged
+static lval *
+lload_get(lload_buf *b, lenv *builtins) {
+	unsigned char type;
+	if (!lload_take(b, &type, 1)) { return NULL; }
+	switch (type) {
+		case LVAL_NUM: {
+			int64_t n;
+			return lload_take(b, &n, sizeof(n)) ? lval_num(n) : NULL;
+		}
+		case LVAL_FNUM: {
+			double d;
+			return lload_take(b, &d, sizeof(d)) ? lval_fnum(d) : NULL;
+		}
+		case LVAL_SYM:
+		case LVAL_STR:
+		case LVAL_ERR: {
+			char *s = lload_take_str(b);
+			if (!s) { return NULL; }
+			return type == LVAL_SYM ? lval_sym(s) :
+				type == LVAL_STR ? lval_str(s) : lval_err("%s", s);
+		}
+		case LVAL_FUN: {
+			char *s = lload_take_str(b);
+			lval *f = s ? lenv_find(builtins, lsym_intern(s, strlen(s))) : NULL;
+			return f ? lval_copy(f) : NULL;
+		}
+		case LVAL_LAMBDA: {
+			if (!builtins) { return NULL; }
+			uint32_t limit;
+			lenv *env = lenv_new();
+			lval *formals = NULL, *body = NULL;
+			if (!lload_take(b, &limit, sizeof(limit)) ||
+				!lload_get_env(b, env, builtins) ||
+				!(formals = lload_get(b, builtins)) || !(body = lload_get(b, builtins)) ||
+				formals->type != LVAL_QEXPR || body->type != LVAL_QEXPR) {
+				lenv_del(env);
+				if (formals) { lval_del(formals); }
+				if (body) { lval_del(body); }
+				return NULL;
+			}
+			lval *f = lval_lambda(formals, body);
+			lenv_del(f->val.context->env);
+			f->val.context->env = env;
+			if (limit != UINT32_MAX) { f->val.context->memo = lmemo_new(limit); }
+			return f;
+		}
+		case LVAL_PARTIAL: {
+			uint32_t count;
+			lval *f = lload_get(b, builtins);
+			if (!f || f->type != LVAL_LAMBDA || !lload_take(b, &count, sizeof(count))) {
+				if (f) { lval_del(f); }
+				return NULL;
+			}
+			lval *args = lval_sexpr();
+			for (uint32_t i = 0; i < count; i++) {
+				lval *x = lload_get(b, builtins);
+				if (!x) {
+					lval_del(f);
+					lval_del(args);
+					return NULL;
+				}
+				lval_add(args, x);
+			}
+			lval *p = lval_partial(f, args);
+			lval_del(f);
+			return p;
+		}
+		case LVAL_SEXPR:
+		case LVAL_QEXPR:
+			return lload_get_list(b, type, builtins);
+	}
+	return NULL;
+}
+
+// the list of the given type next in b, with its cells, or NULL if the
+// file is damaged; like lload_put_list it keeps the lists still open on
+// a stack of its own
+static lval *
+lload_get_list(lload_buf *b, unsigned char type, lenv *builtins) {
+	struct { lval *v; uint32_t left; } *open = malloc(sizeof(*open) * 16);
+	int depth = 0, cap = 16;
+	for (;;) {
+		uint32_t count;
+		if (!lload_take(b, &count, sizeof(count))) { break; }
+		open[depth].v = type == LVAL_SEXPR ? lval_sexpr() : lval_qexpr();
+		open[depth++].left = count;
+		// fills the innermost list until the next one opens in it
+		for (;;) {
+			if (!open[depth - 1].left) {
+				lval *v = open[--depth].v;
+				if (!depth) {
+					free(open);
+					return v;
+				}
+				lval_add(open[depth - 1].v, v);
+				continue;
+			}
+			open[depth - 1].left--;
+			if (!lload_fill(b, 1)) { goto damaged; }
+			type = *b->at;
+			if (type == LVAL_SEXPR || type == LVAL_QEXPR) {
+				b->at++;
+				break;
+			}
+			lval *x = lload_get(b, builtins);
+			if (!x) { goto damaged; }
+			lval_add(open[depth - 1].v, x);
+		}
+		if (depth == cap) { open = realloc(open, sizeof(*open) * (cap *= 2)); }
+	}
+damaged:
+	while (depth) { lval_del(open[--depth].v); }
+	free(open);
+	return NULL;
+}
+
+/*
+ * A source file being read for 'load': from its cache while that is good,
+ * otherwise from the source, writing a new cache as it goes. Should the
+ * cache turn out to be damaged part way, the source takes over after the
+ * forms already given out.
+ */
+struct lload_file {
+	char *path;
+	struct stat st;
+	int cacheable;
+	lload_buf cached;
+	FILE *src;
+	char *map;
+	size_t mapped;
+	size_t released;
+	lreader reader;
+	// whether the source is being read, and has been to its end
+	int reading;
+	int read;
+	FILE *out;
+	char *tmp;
+	// forms given out, and those of the source still to pass over
+	long count;
+	long skip;
+	lval *err;
+};
+
+// starts reading the cache of f, if it is there and up to date
+static int
+lload_open_cache(lload_file *f) {
+	char *cache = lload_cache_path(f->path);
+	FILE *c = fopen(cache, "rb");
+	free(cache);
+	if (!c) { return 0; }
+
+	lload_header want, h;
+	lload_key(&want, &f->st);
+	if (fread(&h, sizeof(h), 1, c) != 1 || memcmp(&h, &want, sizeof(h)) != 0) {
+		fclose(c);
+		return 0;
+	}
+	f->cached.f = c;
+	f->cached.cap = 64 * 1024;
+	f->cached.data = malloc(f->cached.cap);
+	f->cached.at = f->cached.end = f->cached.data;
+	return 1;
+}
+
+static void
+lload_close_cache(lload_file *f) {
+	fclose(f->cached.f);
+	free(f->cached.data);
+	f->cached.f = NULL;
+}
+
+/*
+ * Starts reading the source of f, and writing its cache. A regular file is
+ * mapped and read in place, which the kernel may page out again behind
+ * the reader; anything else, such as a pipe, is streamed through a buffer.
+ */
+static void
+lload_open_source(lload_file *f) {
+	int fd = open(f->path, O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0) {
+		if (fd >= 0) { close(fd); }
+		f->err = lval_err("Could not load library %s: error: Unable to open file!\n",
+			f->path);
+		return;
+	}
+	char *map = S_ISREG(st.st_mode) && st.st_size > 0 ?
+		mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+	if (map != MAP_FAILED) {
+		madvise(map, st.st_size, MADV_SEQUENTIAL);
+		close(fd);
+		f->map = map;
+		f->mapped = st.st_size;
+		lreader_init(&f->reader, f->path, map, f->mapped);
+	} else if (S_ISREG(st.st_mode) && st.st_size == 0) {
+		close(fd);
+		lreader_init(&f->reader, f->path, "", 0);
+	} else {
+		f->src = fdopen(fd, "rb");
+		lreader_open(&f->reader, f->path, f->src);
+	}
+	f->reading = 1;
+	if (f->cacheable) {
+		char *cache = lload_cache_path(f->path);
+		f->out = lload_begin(cache, &f->st, &f->tmp);
+		free(cache);
+	}
+}
+
+// how much of a mapping is read before the pages behind the reader are
+// given back; a multiple of the page size
+#define LLOAD_RELEASE (1 << 20)
+
+// drops the pages of the mapping that the reader has finished with, so
+// they do not pile up in the resident set; the reader keeps no pointers
+// into the text of forms it has returned
+static void
+lload_release(lload_file *f) {
+	size_t done = (f->reader.at - f->map) & ~(size_t) (LLOAD_RELEASE - 1);
+	if (done > f->released) {
+		madvise(f->map + f->released, done - f->released, MADV_DONTNEED);
+		f->released = done;
+	}
+}
+
+lload_file *
+lload_open(char *path) {
+	lload_file *f = calloc(1, sizeof(lload_file));
+	f->path = malloc(strlen(path) + 1);
+	strcpy(f->path, path);
+	f->cacheable = lload_cache && stat(path, &f->st) == 0 && S_ISREG(f->st.st_mode);
+	if (!f->cacheable || !lload_open_cache(f)) { lload_open_source(f); }
+	return f;
+}
+
+// the next form, or NULL at the end or on an error
+lval *
+lload_next(lload_file *f) {
+	if (f->cached.f) {
+		if (!lload_fill(&f->cached, 1)) { return NULL; }
+		lval *v = lload_get(&f->cached, NULL);
+		if (v) {
+			f->count++;
+			return v;
+		}
+		lload_close_cache(f);
+		f->skip = f->count;
+		lload_open_source(f);
+	}
+	if (!f->reading || f->err) { return NULL; }
+
+	for (;;) {
+		lval *v = lread_next(&f->reader);
+		if (!v) {
+			f->read = 1;
+			return NULL;
+		}
+		if (f->reader.failed) {
+			f->err = lval_err("Could not load library %s", v->val.err);
+			lval_del(v);
+			return NULL;
+		}
+		if (f->out) { lload_put(f->out, v, NULL); }
+		if (f->map) { lload_release(f); }
+		if (!f->skip) {
+			f->count++;
+			return v;
+		}
+		f->skip--;
+		lval_del(v);
+	}
+}
+
+// ends reading f, keeping the cache written if the whole source was read
+lval *
+lload_close(lload_file *f) {
+	if (f->cached.f) { lload_close_cache(f); }
+	if (f->reading) { lreader_close(&f->reader); }
+	if (f->src) { fclose(f->src); }
+	if (f->map) { munmap(f->map, f->mapped); }
+	if (f->out) {
+		char *cache = lload_cache_path(f->path);
+		lload_finish(f->out, f->tmp, cache, f->read);
+		free(cache);
+	}
+	lval *err = f->err;
+	free(f->path);
+	free(f);
+	return err;
+}
+
+/*
+ * The forms in the file at path, as an S-expression, or an error if it
+ * cannot be read.
+ */
+lval *
+lload_forms(char *path) {
+	lload_file *f = lload_open(path);
+	lval *forms = lval_sexpr();
+	for (lval *x; (x = lload_next(f)); ) { lval_add(forms, x); }
+	lval *err = lload_close(f);
+	if (err) {
+		lval_del(forms);
+		return err;
+	}
+	return forms;
+}
+
+/* Images */
+
+// writes the bindings of the global environment of e to an image at path
+lval *
+limage_save(lenv *e, char *path) {
+	while (e->par) { e = e->par; }
+	char *tmp;
+	FILE *f = lload_begin(path, NULL, &tmp);
+	int ok = 0;
+	if (f) {
+		lenv *builtins = lenv_new();
+		lenv_add_builtins(builtins);
+		lenv *pending = lautoload_pending();
+		ok = lload_finish(f, tmp, path, lload_put_env(f, e, builtins, 1) &&
+			lload_put_env(f, pending, NULL, 0));
+		lenv_del(pending);
+		lenv_del(builtins);
+	}
+	return ok ? lval_sexpr() : lval_err("Could not save image %s", path);
+}
+
+// binds what the image at path holds in the global environment e
+lval *
+limage_load(lenv *e, char *path) {
+	int fd = open(path, O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(lload_header)) {
+		if (fd >= 0) { close(fd); }
+		return lval_err("Could not load image %s", path);
+	}
+	char *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) { return lval_err("Could not load image %s", path); }
+
+	lload_header want;
+	lload_key(&want, NULL);
+	lenv *builtins = lenv_new();
+	lenv_add_builtins(builtins);
+	lenv *pending = lenv_new();
+	lload_buf b = { data + sizeof(lload_header), data + st.st_size, NULL, NULL, 0 };
+	int ok = memcmp(data, &want, sizeof(want)) == 0 &&
+		lload_get_env(&b, e, builtins) && lload_get_env(&b, pending, NULL) &&
+		b.at == b.end;
+	// registered as 'autoload' would, which checks each is a file name
+	for (int i = 0; ok && i < pending->count; i++) {
+		lval *a = lval_add(lval_sexpr(), lval_copy(pending->vals[i]));
+		lval_add(a, lval_add(lval_qexpr(), lval_sym(pending->syms[i])));
+		lval *x = builtin_autoload(e, a);
+		ok = x->type != LVAL_ERR;
+		lval_del(x);
+	}
+	lenv_del(pending);
+	lenv_del(builtins);
+	munmap(data, st.st_size);
+	return ok ? lval_sexpr() : lval_err("Image %s is damaged or out of date", path);
+}
@@ -0,0 +1,202 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+
+/*
+ * Result tables for lambdas wrapped by 'memo'. Calls are keyed by a
+ * structural hash of their arguments, with lval_eq settling collisions.
+ * Entries also form a list from most to least recently used, which a
+ * table with a size limit evicts from once it is full.
+ *
+ * Like chunks, tables are shared by every copy of the lambda they belong
+ * to, so the copies pushed by each lookup of a memoized global all see
+ * the same results.
+ */
+
+typedef struct lmemo_entry {
+	struct lmemo_entry *chain;
+	struct lmemo_entry *newer;
+	struct lmemo_entry *older;
+	size_t hash;
+	lval *args;
+	lval *result;
+} lmemo_entry;
+
+struct lmemo {
+	int refs;
+	// most entries kept, or 0 to keep them all
+	int limit;
+	int count;
+	size_t cap;
+	lmemo_entry **buckets;
+	lmemo_entry *newest;
+	lmemo_entry *oldest;
+};
+
+static size_t
+lmemo_mix(size_t h, size_t x) {
+	return (h ^ x) * 1099511628211u;
+}
+
+static size_t
+lval_hash(lval *v) {
+	size_t h = lmemo_mix(14695981039346656037u, v->type);
+	switch (v->type) {
+		case LVAL_NUM:
+			return lmemo_mix(h, v->val.num);
+		case LVAL_FNUM: {
+			// 0.0 and -0.0 are equal, so they must hash alike
+			double d = v->val.fnum == 0 ? 0 : v->val.fnum;
+			uint64_t bits;
+			memcpy(&bits, &d, sizeof(bits));
+			return lmemo_mix(h, bits);
+		}
+		case LVAL_SYM:
+			return lmemo_mix(h, (uintptr_t) v->val.sym);
+		case LVAL_FUN:
+			return lmemo_mix(h, (uintptr_t) v->val.builtin);
+		case LVAL_STR:
+		case LVAL_ERR: {
+			char *s = v->type == LVAL_STR ? v->val.str : v->val.err;
+			for (; *s; s++) { h = lmemo_mix(h, (unsigned char) *s); }
+			return h;
+		}
+		case LVAL_LAMBDA:
+			h = lmemo_mix(h, lval_hash(v->val.context->formals));
+			return lmemo_mix(h, lval_hash(v->val.context->body));
+		case LVAL_PARTIAL:
+			// lval_eq leaves the arguments to tell these apart
+			h = lmemo_mix(h, v->val.partial->bound);
+			return lmemo_mix(h, lval_hash(lpartial_fn(v->val.partial)));
+		case LVAL_SEXPR:
+		case LVAL_QEXPR:
+			for (int i = 0; i < v->count; i++) {
+				h = lmemo_mix(h, lval_hash(v->cells[i]));
+			}
+			return h;
+	}
+	return h;
+}
+
+static size_t
+lmemo_hash(lval **args, int argc) {
+	size_t h = lmemo_mix(14695981039346656037u, argc);
+	for (int i = 0; i < argc; i++) {
+		h = lmemo_mix(h, lval_hash(args[i]));
+	}
+	return h;
+}
+
+lmemo *
+lmemo_new(int limit) {
+	lmemo *m = malloc(sizeof(*m));
+	m->refs = 1;
+	m->limit = limit;
+	m->count = 0;
+	m->cap = 64;
+	m->buckets = calloc(m->cap, sizeof(lmemo_entry *));
+	m->newest = NULL;
+	m->oldest = NULL;
+	return m;
+}
+
+int
+lmemo_limit(lmemo *m) {
+	return m->limit;
+}
+
+lmemo *
+lmemo_retain(lmemo *m) {
+	if (m) { m->refs++; }
+	return m;
+}
+
+void
+lmemo_release(lmemo *m) {
+	if (!m || --m->refs > 0) { return; }
+	for (lmemo_entry *n = m->newest, *older; n; n = older) {
+		older = n->older;
+		lval_del(n->args);
+		lval_del(n->result);
+		free(n);
+	}
+	free(m->buckets);
+	free(m);
+}
+
+static void
+lmemo_unlink(lmemo *m, lmemo_entry *n) {
+	if (n->newer) { n->newer->older = n->older; } else { m->newest = n->older; }
+	if (n->older) { n->older->newer = n->newer; } else { m->oldest = n->newer; }
+}
+
+static void
+lmemo_link(lmemo *m, lmemo_entry *n) {
+	n->newer = NULL;
+	n->older = m->newest;
+	if (m->newest) { m->newest->newer = n; } else { m->oldest = n; }
+	m->newest = n;
+}
+
+// borrowed result of an earlier call with these arguments, or NULL
+lval *
+lmemo_get(lmemo *m, lval **args, int argc) {
+	size_t h = lmemo_hash(args, argc);
+	for (lmemo_entry *n = m->buckets[h & (m->cap - 1)]; n; n = n->chain) {
+		if (n->hash != h || n->args->count != argc) { continue; }
+		int i = 0;
+		while (i < argc && lval_eq(n->args->cells[i], args[i])) { i++; }
+		if (i < argc) { continue; }
+
+		if (m->newest != n) {
+			lmemo_unlink(m, n);
+			lmemo_link(m, n);
+		}
+		return n->result;
+	}
+	return NULL;
+}
+
+static void
+lmemo_evict(lmemo *m) {
+	lmemo_entry *n = m->oldest;
+	lmemo_entry **p = &m->buckets[n->hash & (m->cap - 1)];
+	while (*p != n) { p = &(*p)->chain; }
+	*p = n->chain;
+	lmemo_unlink(m, n);
+	lval_del(n->args);
+	lval_del(n->result);
+	free(n);
+	m->count--;
+}
+
+// records a copy of result for the argument list args, which it consumes
+void
+lmemo_put(lmemo *m, lval *args, lval *result) {
+	if (m->limit && m->count >= m->limit) { lmemo_evict(m); }
+
+	// rehash at three quarters load
+	if ((size_t) m->count * 4 >= m->cap * 3) {
+		size_t cap = m->cap * 2;
+		lmemo_entry **buckets = calloc(cap, sizeof(lmemo_entry *));
+		for (lmemo_entry *n = m->newest; n; n = n->older) {
+			n->chain = buckets[n->hash & (cap - 1)];
+			buckets[n->hash & (cap - 1)] = n;
+		}
+		free(m->buckets);
+		m->buckets = buckets;
+		m->cap = cap;
+	}
+
+	lmemo_entry *n = malloc(sizeof(*n));
+	n->hash = lmemo_hash(args->cells, args->count);
+	n->args = args;
+	n->result = lval_copy(result);
+	n->chain = m->buckets[n->hash & (m->cap - 1)];
+	m->buckets[n->hash & (m->cap - 1)] = n;
+	lmemo_link(m, n);
+	m->count++;
+}
@@ -0,0 +1,177 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+/*
+ * Constant folding. Applications of pure builtins to literals, and 'if'
+ * on a literal condition, have their value computed as they are compiled.
+ * With dynamic scoping any caller's local, or a later 'def', may rebind
+ * the operators, so the compiler guards each folded site on the stamps of
+ * the operators it used and falls back to the application when they fail.
+ */
+
+int lopt_dump = 0;
+
+// builtins without side effects, which are safe to run ahead of time
+static lbuiltin lopt_pure[] = {
+	builtin_add, builtin_sub, builtin_mul, builtin_div, builtin_mod,
+	builtin_gt, builtin_lt, builtin_ge, builtin_le, builtin_eq, builtin_ne,
+	builtin_list
+};
+
+static int
+lopt_constant(lval *v) {
+	switch (v->type) {
+		case LVAL_NUM:
+		case LVAL_FNUM:
+		case LVAL_STR:
+		case LVAL_QEXPR:
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+// adds sym to the operators d depends on, or returns 0 if there is no room
+static int
+lopt_dep(lopt_deps *d, char *sym) {
+	for (int i = 0; i < d->count; i++) {
+		if (d->syms[i] == sym) { return 1; }
+	}
+	if (d->count == LOPT_DEPS) {
+		d->full = 1;
+		return 0;
+	}
+	d->syms[d->count++] = sym;
+	return 1;
+}
+
+// the pure builtin the global binding of sym is, if any
+static lbuiltin
+lopt_builtin(lenv *e, char *sym) {
+	lval *f = lenv_find(e, sym);
+	if (!f || f->type != LVAL_FUN) { return NULL; }
+	for (size_t i = 0; i < sizeof(lopt_pure) / sizeof(lopt_pure[0]); i++) {
+		if (f->val.builtin == lopt_pure[i]) { return f->val.builtin; }
+	}
+	return NULL;
+}
+
+/*
+ * S-expressions lopt_value could not fold, by address, so that compiling
+ * the expressions around one does not walk it again each time. They are
+ * only good for the source being compiled, which the compiler marks by
+ * calling lopt_forget before it starts; an address reused since then can
+ * only cost a fold, never give a wrong one.
+ */
+static lval **lopt_failed;
+static size_t lopt_nfailed;
+static size_t lopt_capfailed;
+
+static size_t
+lopt_slot(lval *v) {
+	size_t i = ((uintptr_t) v >> 4) & (lopt_capfailed - 1);
+	while (lopt_failed[i] && lopt_failed[i] != v) {
+		i = (i + 1) & (lopt_capfailed - 1);
+	}
+	return i;
+}
+
+static void
+lopt_fail(lval *v) {
+	if (2 * (lopt_nfailed + 1) > lopt_capfailed) {
+		lval **old = lopt_failed;
+		size_t cap = lopt_capfailed;
+		lopt_capfailed = cap ? 2 * cap : 256;
+		lopt_failed = calloc(lopt_capfailed, sizeof(lval *));
+		for (size_t i = 0; i < cap; i++) {
+			if (old[i]) { lopt_failed[lopt_slot(old[i])] = old[i]; }
+		}
+		free(old);
+	}
+	size_t i = lopt_slot(v);
+	if (!lopt_failed[i]) {
+		lopt_failed[i] = v;
+		lopt_nfailed++;
+	}
+}
+
+void
+lopt_forget(void) {
+	if (lopt_nfailed) {
+		memset(lopt_failed, 0, sizeof(lval *) * lopt_capfailed);
+		lopt_nfailed = 0;
+	}
+}
+
+static lval *lopt_fold(lenv *, lval *, lopt_deps *);
+
+// lopt_value of v as an expression rather than as cells
+static lval *
+lopt_expr(lenv *e, lval *v, lopt_deps *d) {
+	if (lopt_constant(v)) { return lval_copy(v); }
+	return v->type == LVAL_SEXPR ? lopt_value(e, v, d) : NULL;
+}
+
+/*
+ * The value of the cells of v, evaluated as an S-expression, if it can be
+ * computed now from the global bindings of the operators it applies; they
+ * are added to d. Returns NULL otherwise, and errors such as division by
+ * zero are left to be raised at runtime.
+ */
+lval *
+lopt_value(lenv *e, lval *v, lopt_deps *d) {
+	if (lopt_nfailed && lopt_failed[lopt_slot(v)]) { return NULL; }
+	lval *r = lopt_fold(e, v, d);
+	// failures for want of room depend on what else was folded with v
+	if (!r && !d->full) { lopt_fail(v); }
+	return r;
+}
+
+static lval *
+lopt_fold(lenv *e, lval *v, lopt_deps *d) {
+	if (v->count == 1) { return lopt_expr(e, v->cells[0], d); }
+	if (v->count < 2 || v->cells[0]->type != LVAL_SYM) { return NULL; }
+	char *sym = v->cells[0]->val.sym;
+
+	// 'if' cannot be rebound, so only its condition is depended on
+	if (sym == lsym_intern("if", 2)) {
+		if (v->count != 4 ||
+			v->cells[2]->type != LVAL_QEXPR || v->cells[3]->type != LVAL_QEXPR) {
+			return NULL;
+		}
+		lval *x = lopt_expr(e, v->cells[1], d);
+		if (!x || x->type != LVAL_NUM) {
+			if (x) { lval_del(x); }
+			return NULL;
+		}
+		int taken = x->val.num ? 2 : 3;
+		lval_del(x);
+		return lopt_value(e, v->cells[taken], d);
+	}
+
+	lbuiltin fn = lopt_builtin(e, sym);
+	if (!fn || !lopt_dep(d, sym)) { return NULL; }
+
+	lval *a = lval_sexpr();
+	for (int i = 1; i < v->count; i++) {
+		lval *x = lopt_expr(e, v->cells[i], d);
+		if (!x) {
+			lval_del(a);
+			return NULL;
+		}
+		lval_add(a, x);
+	}
+
+	lval *r = fn(e, a);
+	if (r->type == LVAL_ERR) {
+		lval_del(r);
+		return NULL;
+	}
+	return r;
+}
@@ -0,0 +1,271 @@
+// generated by lispyc from "/tmp/aot_fold.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+// f
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = 3L;
+	goto L18;
+L18:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+}
+
+static const int lispyc_code0[] = {
+	10, 0, 0, 12, 9, 0, 1, 12, 18, 0, 2, 0, 3, 7, 0, 4,
+	1, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 5, lval_sym("+"), lval_num(3L), lval_num(1L), lval_num(2L), lval_sym("+"));
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("f")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("+")), lispyc_list(lval_qexpr(), 2, lval_sym("f"), lval_num(0L))));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("g"), lval_sym("-")));
+}
+
+// h
+static int
+lispyc_fn1(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-0];
+	s1 = 2L;
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code1[] = {
+	1, 0, 0, 0, 7, 0, 1, 0, -1, 14
+};
+
+static lval *
+lispyc_consts1(void) {
+	return lispyc_list(lval_qexpr(), 2, lval_num(2L), lval_sym("+"));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("h")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("x"), lval_num(2L))));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g2")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("+")), lispyc_list(lval_qexpr(), 2, lval_sym("h"), lval_num(1L))));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("g2"), lval_sym("-")));
+}
+
+// k
+static int
+lispyc_fn2(long *l, long *out) {
+	long s0;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = 0L;
+	goto L35;
+L35:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+}
+
+static const int lispyc_code2[] = {
+	10, 0, 0, 20, 9, 0, 1, 12, 35, 10, 2, 1, 20, 18, 0, 3,
+	12, 27, 0, 4, 0, 5, 7, 5, 6, 2, -1, 0, 7, 0, 8, 6,
+	9, 3, 3, 14
+};
+
+static lval *
+lispyc_consts2(void) {
+	return lispyc_list(lval_qexpr(), 10, lval_sym(">"), lval_num(0L), lval_sym(">"), lval_num(0L), lval_num(1L), lval_num(2L), lval_sym(">"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 1, lval_num(0L)), lval_sym("if"));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("k")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_num(1L), lval_num(2L)), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 1, lval_num(0L)))));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g3")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym(">")), lispyc_list(lval_qexpr(), 2, lval_sym("k"), lval_num(5L))));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("g3"), lval_sym("<")));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("k"), lval_num(5L)));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("l")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_num(2L), lval_num(3L)))));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g4")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("*")), lispyc_list(lval_qexpr(), 2, lval_sym("l"), lval_num(0L))));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("g4"), lval_sym("+")));
+}
+
+// +
+static int
+lispyc_fn3(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-0];
+	s1 = l[-1];
+	if (__builtin_mul_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code3[] = {
+	1, 0, 1, 1, 7, 2, 0, 0, -1, 14
+};
+
+static lval *
+lispyc_consts3(void) {
+	return lispyc_list(lval_qexpr(), 1, lval_sym("*"));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("+")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b"))));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("f"), lval_num(0L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "f", lispyc_code0, 19, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "h", lispyc_code1, 10, lispyc_consts1(), lispyc_fn1);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "k", lispyc_code2, 36, lispyc_consts2(), lispyc_fn2);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "+", lispyc_code3, 10, lispyc_consts3(), lispyc_fn3);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
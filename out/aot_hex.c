@@ -0,0 +1,38 @@
+// generated by lispyc from "/tmp/aot_hex.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 3000, lval_num(828004L), lval_num(389609433L), lval_num(1927728186L), lval_num(34950701686733L), lval_num(-32354L), lval_num(-2538365L), lval_num(-118279875L), lval_num(102492200594L), lval_num(1800700372425061L), lval_num(227441L), lval_num(-4722427498974644L), lval_num(166L), lval_num(-18583590L), lval_num(136510965742L), lval_num(1037276L), lval_num(-71535405L), lval_num(71337244942729377L), lval_num(43L), lval_num(-151749294891559682L), lval_num(181425239L), lval_err("%s", "invalid number"), lval_err("%s", "invalid number"), lval_num(-2L), lval_num(19827028277768856L), lval_num(2496302649629125L), lval_num(-315288L), lval_num(18726681197L), lval_num(-1349155747158275577L), lval_num(-3280685218L), lval_num(3696982160344394070L), lval_num(17367067760L), lval_num(-71117077009055702L), lval_num(7582004051403942L), lval_num(-23L), lval_num(-6697922807094468L), lval_num(13106607250360992L), lval_num(11387175044491L), lval_num(-6737464425412850L), lval_num(-350089148317L), lval_num(8258L), lval_num(-1433508209897L), lval_err("%s", "invalid number"), lval_num(-4153814915L), lval_num(404L), lval_num(3460228620954377538L), lval_num(45860109L), lval_num(2016293721733713301L), lval_num(-393L), lval_num(-79043343L), lval_num(8052L), lval_num(-124300408L), lval_num(-11L), lval_num(-989792417L), lval_num(-4703811992288L), lval_num(-4167980L), lval_num(-32800220636321171L), lval_num(74277905351243203L), lval_num(-37317167701381L), lval_num(65877983437955L), lval_err("%s", "invalid number"), lval_num(-203L), lval_num(-87035L), lval_num(2L), lval_num(-14152746L), lval_num(14L), lval_num(-1969189032939865918L), lval_num(847129405849059L), lval_num(1985L), lval_num(42196984810060L), lval_num(-195697740156L), lval_num(1024626623184L), lval_num(-2372L), lval_num(3L), lval_num(764L), lval_num(3169929502486L), lval_num(-23928722441L), lval_num(-69620290598171804L), lval_num(-4103214393L), lval_num(-5158131025686194361L), lval_num(3525373766592L), lval_num(220582L), lval_num(-137L), lval_num(-415163836L), lval_num(-33573553530452L), lval_num(-337712438185375846L), lval_num(114473566L), lval_num(93875320768365678L), lval_num(103205135289147L), lval_num(-4L), lval_num(6995205707L), lval_num(94296500416797L), lval_num(36194181L), lval_num(-699831184214960L), lval_num(65369011072363L), lval_num(-43434850L), lval_err("%s", "invalid number"), lval_num(301899366L), lval_num(114984432L), lval_num(-4550015795L), lval_num(-21065517721085L), lval_num(-58104407548629L), lval_num(193606L), lval_err("%s", "invalid number"), lval_num(14500L), lval_num(154820000811900376L), lval_num(468733811490L), lval_num(-68821361001094L), lval_num(4833L), lval_num(7766116051L), lval_num(-1881510L), lval_num(-724864286354762911L), lval_num(5945L), lval_num(-69018557683671L), lval_num(174327606260831482L), lval_num(38215465772L), lval_num(-31359638743123327L), lval_num(11370094314L), lval_num(173855849L), lval_num(-32970994L), lval_num(2002239L), lval_num(-19767L), lval_err("%s", "invalid number"), lval_num(1L), lval_num(443064806672550L), lval_num(-4664557703133262366L), lval_num(-227503487672L), lval_num(226698799398031256L), lval_num(-1309824876L), lval_num(1795586850614L), lval_num(-6417L), lval_num(316638530L), lval_num(-122375943470185196L), lval_num(-20L), lval_num(-991186218284175761L), lval_num(-547945L), lval_num(-5144138548L), lval_num(186917863L), lval_num(1055489323L), lval_num(93L), lval_num(59720594079L), lval_num(850461781L), lval_num(-18L), lval_num(-518448213L), lval_err("%s", "invalid number"), lval_num(-255L), lval_num(350320930499566L), lval_num(1250571185L), lval_num(2079375L), lval_num(425079264598L), lval_num(13367950446L), lval_num(-545369063977244L), lval_num(-52931L), lval_num(-5201531389972762L), lval_num(37041L), lval_num(279L), lval_num(-8L), lval_num(-234289L), lval_num(2713050556023631347L), lval_num(-1563331452628L), lval_num(1106226448327L), lval_num(10269385359708L), lval_num(3278L), lval_num(-3062L), lval_num(60L), lval_num(34371208952529L), lval_num(-170416889185651L), lval_num(1471555469L), lval_num(1713L), lval_num(-1679212L), lval_num(239986564392768L), lval_num(-7201L), lval_num(-34100670496438582L), lval_num(-1955L), lval_err("%s", "invalid number"), lval_num(878678595521L), lval_num(-594666476139L), lval_num(-2321494L), lval_num(-29258987L), lval_num(-241L), lval_num(15619746L), lval_num(6731348555204808073L), lval_num(66725445L), lval_num(4L), lval_num(-16902989L), lval_num(-714L), lval_num(-1113827L), lval_num(21267361149400304L), lval_num(1433170704219353427L), lval_num(4866413079L), lval_num(198595341L), lval_num(6497520933L), lval_num(1262774L), lval_num(5363835L), lval_num(2129638246931280545L), lval_num(235856143160L), lval_num(112542L), lval_num(3382068540491184428L), lval_num(-8638415146154456710L), lval_num(0L), lval_num(161862255234L), lval_num(-79171088506297030L), lval_num(-85255194279394L), lval_num(228L), lval_num(6633168457287910L), lval_num(375777034381179L), lval_num(5074913836121319326L), lval_num(-212341016942083792L), lval_num(-477924390866131L), lval_num(-430L), lval_num(18788L), lval_num(49030237164L), lval_num(212920569882L), lval_num(-63L), lval_num(-42L), lval_num(-15724856656L), lval_num(-22443248822841256L), lval_num(1517533L), lval_num(-62009796266L), lval_num(1253L), lval_num(41763024L), lval_num(-6L), lval_num(58441L), lval_num(-16L), lval_num(58371415120339L), lval_num(-6095L), lval_num(-121410729468225436L), lval_num(-836992017019231L), lval_num(16097303049L), lval_num(-5L), lval_num(-233983252830321960L), lval_err("%s", "invalid number"), lval_num(32L), lval_num(-944952031L), lval_num(1051314221208189380L), lval_num(891425L), lval_num(2449966L), lval_num(-863909L), lval_num(369270007L), lval_num(-50L), lval_num(-8400959L), lval_num(425604221271002639L), lval_num(-55L), lval_num(-7477576273724L), lval_num(16467271614L), lval_num(-6L), lval_num(29496147737650754L), lval_num(90146116128011195L), lval_num(-10776695776L), lval_num(311085706191124721L), lval_num(26992998417486451L), lval_num(3237729953493L), lval_num(54429772519512L), lval_num(59860336883L), lval_num(-109623L), lval_num(-6113783887991927L), lval_num(6201L), lval_num(-553922377423171L), lval_num(-2012331051L), lval_num(-128402955028058387L), lval_num(44256216382704831L), lval_num(-1L), lval_num(-1856951L), lval_num(-64710L), lval_num(-2484399521266L), lval_num(3526852256187469695L), lval_err("%s", "invalid number"), lval_num(-3765201695222L), lval_num(4L), lval_num(116845377L), lval_num(76521110L), lval_num(-5141439773002246L), lval_err("%s", "invalid number"), lval_num(-14093885111945L), lval_num(477817486774661872L), lval_num(3843L), lval_num(-2528806063L), lval_num(-50855028937891L), lval_num(-8174156561L), lval_num(36829697L), lval_num(-30007L), lval_num(5759831511183L), lval_num(-20297019412L), lval_num(108L), lval_num(-12137221221L), lval_num(-4687627300L), lval_num(-2410688259870L), lval_num(-11409L), lval_num(5174L), lval_num(-103980507129827491L), lval_num(13765935L), lval_num(-57L), lval_num(40011775524L), lval_num(-18788L), lval_num(181L), lval_num(88892231947013987L), lval_num(242650831L), lval_num(-12L), lval_num(-3241836559924250330L), lval_num(970593229668L), lval_num(-3253067238L), lval_num(-1496288810L), lval_num(3074665546L), lval_num(-1952227579375812732L), lval_num(-627L), lval_num(22893952110982L), lval_num(-25827239163L), lval_num(876443905L), lval_num(59619L), lval_num(2L), lval_num(-5235L), lval_num(-3677863429L), lval_num(64061L), lval_num(-16L), lval_num(14092286295082L), lval_num(-1734897L), lval_num(-1316L), lval_num(-58096888L), lval_num(16594500185L), lval_err("%s", "invalid number"), lval_num(9L), lval_num(-17653787226964806L), lval_num(-2204186342583348988L), lval_num(-204775518L), lval_num(1244L), lval_num(56550270L), lval_num(149766785061420567L), lval_num(-16776L), lval_num(-412051252469L), lval_err("%s", "invalid number"), lval_num(8337L), lval_num(-1499259098846077662L), lval_num(-388L), lval_num(-30485L), lval_num(275265133522292L), lval_num(27873684191L), lval_num(-1924474266664290859L), lval_num(-1008L), lval_num(26442896874302L), lval_num(24412763756493L), lval_num(-4654709590555223163L), lval_num(-153123116616L), lval_num(16822L), lval_num(51L), lval_num(-2L), lval_num(-220770L), lval_num(-949L), lval_num(-214936209496L), lval_num(-31196842304471197L), lval_num(29020L), lval_num(-465854975552145866L), lval_num(-17162676L), lval_num(10190772145220129L), lval_num(322856096L), lval_num(4175347L), lval_num(11547257572L), lval_num(6162580998L), lval_num(99L), lval_num(23856L), lval_num(-29882684233L), lval_num(75161321750L), lval_num(5531143162263006928L), lval_num(7312246127272L), lval_num(6641939452202632062L), lval_num(-110760661L), lval_num(-1036234925L), lval_num(-6L), lval_num(1515455L), lval_num(4174787L), lval_num(49724L), lval_num(22446L), lval_num(-10762261278410L), lval_num(-2631262L), lval_num(-54564619815549226L), lval_num(5742L), lval_num(8163838363L), lval_num(1282885450531L), lval_num(-921622827686L), lval_num(-54862L), lval_num(11702L), lval_num(33080887L), lval_num(2574487789490579891L), lval_num(135542L), lval_num(29724613851L), lval_num(-2029769L), lval_num(-8L), lval_num(-33195167938239968L), lval_num(-3L), lval_num(573742118415228127L), lval_num(0L), lval_num(-780683497L), lval_num(55932818955L), lval_num(137410346098406L), lval_num(48L), lval_num(-10265342L), lval_num(13204762227410769L), lval_num(-25985758912549L), lval_num(-1476046203313L), lval_num(231993748218614755L), lval_num(-149L), lval_num(-10529L), lval_num(3L), lval_num(14043L), lval_num(840608L), lval_num(-514L), lval_num(1777L), lval_num(-75L), lval_num(2484887877748L), lval_num(2753314451593999883L), lval_num(-128551372005049814L), lval_num(14L), lval_num(-2L), lval_num(-402355767204976022L), lval_num(-348492982480967L), lval_num(-3920480434994514L), lval_num(14397953254586182L), lval_num(-9450982444271697L), lval_num(-57794814439315L), lval_num(2423L), lval_num(773300124881704721L), lval_num(-8332158240978014L), lval_num(877943165L), lval_num(-29522820L), lval_num(-1033360L), lval_num(662555837L), lval_num(-1725045140L), lval_num(877257L), lval_num(1L), lval_num(22810888994784209L), lval_num(1005359727L), lval_num(-7583474616867644372L), lval_num(245606246931773L), lval_num(-3605759300393971L), lval_num(-57L), lval_num(3665217L), lval_num(-2776L), lval_num(-5223378L), lval_num(-4692323872962698L), lval_num(5322606293234058L), lval_num(6L), lval_num(13L), lval_num(2788017149521L), lval_num(1284763692857041L), lval_num(43L), lval_num(-215655332673168478L), lval_num(-341776610L), lval_num(-3162305419178444L), lval_num(-391426683L), lval_num(-231296009L), lval_num(-5631027949364237403L), lval_num(90L), lval_num(-181079132255374L), lval_num(14L), lval_num(1402495L), lval_err("%s", "invalid number"), lval_num(4209402519711393230L), lval_num(5128L), lval_num(30362067L), lval_num(1731621946079450L), lval_num(11353L), lval_num(14349383306025L), lval_num(107750296436L), lval_num(-325875594188L), lval_num(2L), lval_num(-9566633L), lval_num(-113784028L), lval_num(59602105162520506L), lval_num(-12351740126004941L), lval_num(-246492916589795L), lval_num(-44937817229074L), lval_num(589639054702386165L), lval_num(3046137522695198684L), lval_num(-6385766728386761L), lval_num(-15L), lval_err("%s", "invalid number"), lval_num(-322229577978836L), lval_num(2076361L), lval_num(8531788800L), lval_num(3L), lval_num(132L), lval_num(688L), lval_num(4592L), lval_num(-6143514278650498444L), lval_num(-73001202060L), lval_num(2L), lval_num(78L), lval_num(-4L), lval_num(-1927767L), lval_num(-503195361L), lval_num(-60040L), lval_num(4451250818L), lval_num(13800290636911381L), lval_num(42657L), lval_num(20576215306896431L), lval_num(1656298L), lval_num(-4506083557L), lval_num(3940L), lval_num(-51183122037210289L), lval_num(4640L), lval_num(-87279457840926149L), lval_num(32L), lval_num(-14321926426L), lval_num(-1127217629960025L), lval_num(-5855639165676L), lval_num(-23964625L), lval_num(-163225469972L), lval_num(4800467L), lval_num(219758685002L), lval_num(41534538807391126L), lval_num(1833736L), lval_num(6302999007277163L), lval_num(-50000369061547L), lval_num(-327292213556300977L), lval_num(-323308341L), lval_num(189782383932768686L), lval_num(-857L), lval_num(26857L), lval_num(-13940L), lval_num(-30498592214L), lval_num(1064387926186931360L), lval_num(-13739L), lval_num(7L), lval_num(-3L), lval_num(14588L), lval_num(32444170883574235L), lval_num(417L), lval_num(-6335746562996L), lval_num(1597054774149L), lval_err("%s", "invalid number"), lval_num(-165292467298L), lval_num(0L), lval_num(-1983456911L), lval_num(-537L), lval_num(-122L), lval_num(-33539215194L), lval_num(-91L), lval_num(279874537352215L), lval_num(843679690L), lval_num(7378990753191L), lval_num(54995L), lval_num(164374819549050482L), lval_num(-251556541721L), lval_num(502L), lval_num(1453153042231229098L), lval_num(4496469432461814L), lval_num(-304402524061944L), lval_err("%s", "invalid number"), lval_num(63405890932222L), lval_num(8196829L), lval_num(11478192L), lval_num(0L), lval_num(-37L), lval_num(-227865920382800L), lval_num(-252636355072436566L), lval_num(1693646233L), lval_num(-258647053443690734L), lval_num(1L), lval_num(-5804954416372847L), lval_num(-63545686L), lval_num(210751744092883879L), lval_num(-339957642133L), lval_num(379839346906893L), lval_num(408L), lval_num(52703457331L), lval_num(3089538L), lval_num(-186L), lval_num(78689465723237L), lval_num(-716L), lval_num(-3491L), lval_num(-306811L), lval_num(-835998109627963688L), lval_num(22810L), lval_num(14571913278L), lval_num(335L), lval_num(956514952712L), lval_num(10383501616L), lval_num(-60817039600194265L), lval_num(11998126L), lval_num(-4148337490680333347L), lval_num(-4543L), lval_num(353520719699L), lval_num(-3700920536L), lval_num(-7068829579810454L), lval_num(-191890676L), lval_num(-933544246787834L), lval_err("%s", "invalid number"), lval_num(186L), lval_num(-265563928269011124L), lval_num(-244641L), lval_num(75980252346838502L), lval_num(-73833540880295L), lval_num(1542391866856675L), lval_num(-14L), lval_num(-1066159508444L), lval_num(0L), lval_num(-16210376L), lval_num(-18569369L), lval_num(2150973765792619L), lval_num(-473426380088381L), lval_num(-32075359256597607L), lval_num(-72L), lval_num(-6658144854713117L), lval_num(3406276647L), lval_num(60538375742L), lval_num(1308705132723961393L), lval_num(-922755872068149134L), lval_num(-54014914177941L), lval_num(24056275040L), lval_num(46597124528208L), lval_num(-1L), lval_num(-36861L), lval_num(513420030849425019L), lval_num(226750L), lval_num(-369260659L), lval_num(10856388425128L), lval_err("%s", "invalid number"), lval_num(182866928588449237L), lval_num(-129266L), lval_num(-8518984432094L), lval_num(-1620363903387187L), lval_num(-246703241258093L), lval_num(-188001824L), lval_num(2834662038953098L), lval_num(-1934L), lval_err("%s", "invalid number"), lval_num(8L), lval_num(-53042L), lval_num(117647833689368L), lval_num(-1256363598747902L), lval_num(-948493L), lval_num(8160008866681L), lval_num(509850347L), lval_num(3143120484820588737L), lval_num(-7316548948864L), lval_num(107881112904263495L), lval_err("%s", "invalid number"), lval_num(-260350341071324L), lval_num(34745L), lval_num(12413692219L), lval_num(4L), lval_num(-1119676822636L), lval_num(0L), lval_num(-5062147025986026L), lval_num(30324993664L), lval_num(-9524528926910L), lval_num(-50309274168981298L), lval_num(-5138986861L), lval_num(8480062987940742864L), lval_err("%s", "invalid number"), lval_num(28175L), lval_num(45927826811970L), lval_num(214L), lval_num(-7224L), lval_num(5712474552686145L), lval_num(-9681731247299L), lval_err("%s", "invalid number"), lval_num(-4961L), lval_num(-7402112L), lval_num(-45L), lval_num(-8237363L), lval_num(241395905539475L), lval_num(5L), lval_num(97000496L), lval_num(29294701311190330L), lval_num(147039236083L), lval_num(6502L), lval_err("%s", "invalid number"), lval_num(68367272L), lval_num(650415309L), lval_num(3700492512080574L), lval_num(-10269563107285601L), lval_num(5012286371470940L), lval_num(2L), lval_num(173236606684L), lval_num(-46068L), lval_num(4L), lval_num(-523131296L), lval_num(-62084412L), lval_num(40798L), lval_num(0L), lval_num(5316974311L), lval_num(89604396988L), lval_num(-4L), lval_num(8543415257646801L), lval_num(1108849594874687088L), lval_num(939L), lval_num(-5L), lval_num(81526593143648808L), lval_num(-1642950767180623497L), lval_num(8408109803L), lval_num(-3042119137417591L), lval_num(-1210248497650008379L), lval_num(-152731L), lval_num(31081564L), lval_num(-48L), lval_num(-997339213332L), lval_num(-43332680L), lval_num(-705730033258524L), lval_num(-17722669399L), lval_num(14L), lval_num(-179538L), lval_num(8952452723894L), lval_num(10046608476399L), lval_num(-2132012657377939L), lval_num(-247537128118281L), lval_num(-6285176909L), lval_num(-4296119L), lval_num(-210860016320617945L), lval_num(-1L), lval_num(-2376146907415928015L), lval_num(1397724732328311075L), lval_num(1083413407731L), lval_num(-11107847024544628L), lval_num(-16292155982753L), lval_num(-28588335L), lval_num(-1057622L), lval_num(2031206848235L), lval_num(-32863981900294L), lval_num(-276099772922525L), lval_num(-15664500L), lval_num(-15173L), lval_num(-14111182534L), lval_num(14830698732L), lval_num(-6L), lval_num(-79925L), lval_num(-557603154976L), lval_num(-6238930896L), lval_num(-786L), lval_num(1055995611808L), lval_num(-14997626466L), lval_num(26413971674L), lval_num(632683446139L), lval_num(-338719021674L), lval_num(8783859550167358L), lval_num(97944667420454L), lval_num(1L), lval_num(-1907519772331683966L), lval_num(1825652L), lval_num(133L), lval_num(57181867831215934L), lval_num(-61L), lval_num(-10L), lval_num(12469657021L), lval_num(-25L), lval_num(-540127187944726382L), lval_num(1619391243815867L), lval_num(254900L), lval_num(33812242L), lval_num(27878042L), lval_num(7469282907063635761L), lval_num(5780474081L), lval_num(607L), lval_num(-2172L), lval_err("%s", "invalid number"), lval_num(-8498488295656L), lval_num(-9115591L), lval_err("%s", "invalid number"), lval_num(-144458120855694182L), lval_num(2L), lval_num(-31551363119383571L), lval_num(-1560917618998L), lval_num(77403689L), lval_num(216934712040374L), lval_num(-18221189L), lval_num(-215317468025L), lval_num(-201656L), lval_num(248202614062L), lval_num(14L), lval_num(-10L), lval_num(-1947057571050L), lval_num(-7135114L), lval_num(4414404144373470L), lval_num(-1746L), lval_num(-738899515568755L), lval_num(-6235718747535589138L), lval_num(115L), lval_num(-1317143208468L), lval_num(12263255813332167L), lval_num(814754812228L), lval_num(5L), lval_num(0L), lval_num(1268749143959L), lval_num(-13L), lval_num(-1159344163999053599L), lval_num(77483394649L), lval_num(91676151213805L), lval_num(136658L), lval_num(396816L), lval_num(83940L), lval_num(40961L), lval_num(131386883250766373L), lval_num(2496197785877L), lval_num(0L), lval_num(-7L), lval_num(-3L), lval_num(4075816L), lval_num(909764373707289935L), lval_num(-12317650939L), lval_num(-8L), lval_num(-36267032L), lval_num(1694238630542L), lval_num(-22334L), lval_num(4660212246L), lval_num(-488259448221049L), lval_num(-33437L), lval_err("%s", "invalid number"), lval_num(-30011104754L), lval_num(59569L), lval_num(-249700053218614783L), lval_num(26L), lval_num(947329936L), lval_num(221570208980L), lval_num(24612191L), lval_num(-65064L), lval_num(1981844L), lval_num(-238672606305313L), lval_num(-7176694804L), lval_num(444287957748L), lval_num(-7822960733902L), lval_num(-2111L), lval_num(-7381L), lval_num(43317464723L), lval_num(-523651567692L), lval_num(-10168434470402444L), lval_num(-3462885903922654L), lval_num(-1L), lval_err("%s", "invalid number"), lval_num(129868437L), lval_num(4377125330729L), lval_num(1080033165272503L), lval_num(789378396345211223L), lval_num(-508864L), lval_num(154L), lval_num(23745469L), lval_num(-79539927L), lval_num(-1053221506812416100L), lval_num(-1231203649198L), lval_num(-805003040L), lval_num(-881858061323L), lval_num(0L), lval_num(-8149739724266991L), lval_num(-22933L), lval_err("%s", "invalid number"), lval_num(-240982L), lval_num(3948898021925L), lval_num(2185274014848241L), lval_num(-63279647666L), lval_num(-118411839857641838L), lval_num(-440301411476201L), lval_num(78650482L), lval_num(3508386L), lval_num(31860424150L), lval_num(8L), lval_num(7817131457125259L), lval_num(48L), lval_err("%s", "invalid number"), lval_num(199595369L), lval_num(-8908484602244177329L), lval_num(457933998036191L), lval_num(12929364310L), lval_num(-800835423L), lval_num(-863519687686961L), lval_err("%s", "invalid number"), lval_num(5087039L), lval_num(-4195337124584L), lval_num(23251021110862378L), lval_num(2216332323066805L), lval_num(-2563592348163219502L), lval_num(9L), lval_num(124055L), lval_num(-6317010611939967L), lval_err("%s", "invalid number"), lval_num(-969123370L), lval_num(247107L), lval_num(5L), lval_num(6733154260353745L), lval_num(-31750L), lval_num(-42193113227122492L), lval_num(2L), lval_num(-18205961L), lval_num(-1265525448645L), lval_num(11062349185L), lval_num(295L), lval_num(99852013625021023L), lval_num(5400002810484L), lval_num(-77652183436152913L), lval_num(-586723188227L), lval_num(-264959632L), lval_num(125504627515798L), lval_num(-58420337365L), lval_num(-11192510067211712L), lval_num(429269L), lval_num(2L), lval_num(1224865264990416L), lval_num(21907L), lval_num(21L), lval_num(0L), lval_num(-1295089L), lval_num(-76991129L), lval_num(6429303279786455751L), lval_num(23L), lval_num(119569281965597L), lval_num(-4L), lval_num(-91546136405131L), lval_num(97093L), lval_num(-931025694348227L), lval_num(1956267626L), lval_num(-2687L), lval_num(-15081904L), lval_num(5504777021L), lval_num(-19840216702602799L), lval_num(-3834L), lval_num(7946563842468183205L), lval_num(-269277705328L), lval_num(128668194791401L), lval_num(-8612595L), lval_num(-860047936850795L), lval_num(5432315438877116947L), lval_num(1625593195L), lval_num(3250L), lval_num(0L), lval_num(-70657575583L), lval_num(-1467138722981L), lval_num(11581792799L), lval_num(30625L), lval_num(33054925530042L), lval_num(-41674L), lval_num(-103991283100013567L), lval_num(-872933L), lval_num(-218540217L), lval_num(2L), lval_num(6164499035352100L), lval_num(-2971035878025686740L), lval_num(36464721019L), lval_num(-8424369889137693L), lval_num(3684778325057L), lval_num(-223938L), lval_num(5532060268383851L), lval_num(2388230583765117002L), lval_num(176383194577L), lval_num(-259975L), lval_num(225063125011819247L), lval_num(-62404L), lval_num(2674194851168L), lval_num(2797918061791L), lval_num(108L), lval_num(-12L), lval_num(744L), lval_num(122214002325582L), lval_num(4937341609422L), lval_num(7194L), lval_num(-220271518L), lval_num(-454466821L), lval_num(-2402291L), lval_num(1698340377L), lval_num(-5565845087457L), lval_num(-909270804L), lval_num(7L), lval_num(69154102604686430L), lval_num(970911843095802L), lval_num(-7122630L), lval_num(-12780185L), lval_num(995486307L), lval_num(-37549892L), lval_num(5468L), lval_num(812934969121L), lval_num(12477752L), lval_num(7045703672324905388L), lval_num(-203052288L), lval_num(-486014821L), lval_num(-1678611017102151L), lval_num(144L), lval_num(-650L), lval_num(4309621462776614326L), lval_num(-498544L), lval_num(-9157003L), lval_num(1676170L), lval_num(-108192674L), lval_num(-3997096882542253L), lval_num(11062860038L), lval_num(405333059813337L), lval_num(-5946L), lval_num(14025594L), lval_num(-957209572358822L), lval_num(-1469712899L), lval_num(-3226203592590L), lval_num(-9L), lval_num(-359287665767L), lval_num(2497974L), lval_num(4L), lval_num(199972200778916442L), lval_num(-218440731896455009L), lval_num(-239691779347390891L), lval_num(822615617880027660L), lval_num(1L), lval_num(18930232991489326L), lval_num(105L), lval_num(-24180699L), lval_num(957770584713609299L), lval_num(8L), lval_err("%s", "invalid number"), lval_num(733138694L), lval_num(50392550982L), lval_num(8801494879171324273L), lval_num(-56793894L), lval_num(6419L), lval_num(1944596923379204L), lval_num(95078721L), lval_num(-126407492357914138L), lval_num(-25817387302L), lval_num(-38009L), lval_num(-4233347371L), lval_err("%s", "invalid number"), lval_num(67569503357883L), lval_num(471719L), lval_num(7118951142L), lval_num(-28L), lval_num(1168280879351838429L), lval_num(-8913318542923L), lval_num(65226177131488L), lval_num(5213960798957340L), lval_num(-247093021199305767L), lval_num(-4004802L), lval_num(13L), lval_num(296623670294961425L), lval_num(-850344900647L), lval_num(26145L), lval_num(-16355199832862L), lval_num(-363L), lval_num(2200838613982160410L), lval_num(-85438874917L), lval_num(-28944146060142248L), lval_num(3359515681563321L), lval_num(-80L), lval_num(27347L), lval_num(271167163L), lval_num(201066999L), lval_num(-1569806698L), lval_num(473261878753735L), lval_num(-21320573470691L), lval_num(-4L), lval_num(-128570737997782667L), lval_num(471217L), lval_num(-1961025277845L), lval_num(124498636L), lval_num(65L), lval_num(7L), lval_num(-5887L), lval_num(-2046045709458230L), lval_num(-6628476821661564194L), lval_num(-4760L), lval_num(29706L), lval_num(3393059788570007903L), lval_num(-576L), lval_num(78953197128914227L), lval_num(-377274L), lval_err("%s", "invalid number"), lval_num(-452L), lval_num(3L), lval_num(0L), lval_num(554L), lval_num(34648164754L), lval_num(-35589446067994774L), lval_num(15L), lval_num(-1712035L), lval_num(-30613888225837L), lval_num(5204782182613L), lval_num(1L), lval_num(5288244155443488L), lval_num(-467844L), lval_err("%s", "invalid number"), lval_err("%s", "invalid number"), lval_num(5023733648109843874L), lval_num(1234792L), lval_num(497857L), lval_num(1044980879884290L), lval_num(-6865418736812260L), lval_num(-85533L), lval_num(-673581L), lval_num(3240646511190L), lval_num(119553871L), lval_num(-1L), lval_num(-909821361483574597L), lval_num(140776L), lval_num(-62L), lval_num(-6788196489201L), lval_num(-495672220L), lval_num(-611077744068217692L), lval_num(500523L), lval_num(840101726624943207L), lval_num(-255968767L), lval_num(-192609071418L), lval_num(12494220845346591L), lval_num(-8L), lval_num(-72507022201311L), lval_num(48540594945L), lval_num(-256976771030529510L), lval_num(155638L), lval_num(2112507188802005343L), lval_num(-1834783632250995L), lval_num(-212029662107L), lval_num(-22326420961668850L), lval_num(209845080840290707L), lval_num(-302820L), lval_num(-11210314054285L), lval_num(-11L), lval_num(6904560L), lval_num(-35606789648L), lval_num(-266899467093228L), lval_num(-91L), lval_num(-1131734417L), lval_num(-275002723920441L), lval_num(-203L), lval_num(431L), lval_num(2465549L), lval_num(-10072713L), lval_num(764165443771639L), lval_num(-119203152278L), lval_num(2684517594899L), lval_num(-14917657485481287L), lval_err("%s", "invalid number"), lval_num(-42632815L), lval_num(26L), lval_num(35630188137L), lval_num(34L), lval_num(-15L), lval_num(-98173396L), lval_num(-1313L), lval_num(2685L), lval_num(2821783L), lval_num(-930036L), lval_num(-8838983424459528051L), lval_num(-104L), lval_num(34878779494355L), lval_num(-710769325L), lval_num(31325582459L), lval_num(-19197553561425L), lval_num(-85002064444543L), lval_num(14885865998264L), lval_num(26L), lval_num(-1L), lval_num(-258106964331L), lval_num(-144L), lval_num(-18182592L), lval_num(0L), lval_num(19085642849234L), lval_num(35459381223913233L), lval_num(-176060320L), lval_num(203838393881161799L), lval_num(65394227L), lval_num(753452931L), lval_num(41535661828320L), lval_num(-438L), lval_num(133015718038031L), lval_num(-121282604884430061L), lval_num(2954442L), lval_num(166666L), lval_num(-2L), lval_num(-6245661324L), lval_num(2L), lval_num(229164759L), lval_num(-7138437187L), lval_num(16535257L), lval_num(2439587656550L), lval_num(6042851L), lval_num(176052128L), lval_num(-3308L), lval_num(-25993832610769706L), lval_num(187372669127L), lval_err("%s", "invalid number"), lval_num(-996729L), lval_num(0L), lval_num(-14265905L), lval_num(-3214708408841327L), lval_num(83647L), lval_num(-826217466438L), lval_num(-886999805859L), lval_num(374L), lval_num(-7038716313297L), lval_num(-356324636L), lval_num(3032555406523629L), lval_num(62958761083339556L), lval_num(1940738L), lval_num(951516342459L), lval_num(248967610718678L), lval_num(-4393142064355804L), lval_num(-265922613096L), lval_num(31723824L), lval_num(-51352L), lval_num(-2628743788833517145L), lval_num(937894383440565L), lval_num(-534319933180L), lval_err("%s", "invalid number"), lval_num(7808590382L), lval_num(6130083714744974952L), lval_num(-52L), lval_num(421650L), lval_num(57607120640649L), lval_num(1049214780361L), lval_num(-942305187686948L), lval_num(-167505L), lval_num(-1475425547700L), lval_num(-99298584433689L), lval_num(39506967188625664L), lval_num(31256094876756L), lval_num(1144856002L), lval_num(-3668940204158472L), lval_num(-10077258435L), lval_num(-38525922262L), lval_num(341145394133688L), lval_num(-691L), lval_num(-3483756755012042837L), lval_err("%s", "invalid number"), lval_num(7191678L), lval_num(-8292999L), lval_num(-3441L), lval_num(1799532697125078L), lval_num(-38L), lval_num(-791534782907L), lval_num(65169519791290L), lval_num(24L), lval_num(-1L), lval_num(-21900606987L), lval_num(1L), lval_num(393006709L), lval_num(27483L), lval_num(-37392775L), lval_num(124865142370981750L), lval_num(-43L), lval_num(384236L), lval_num(7244L), lval_err("%s", "invalid number"), lval_err("%s", "invalid number"), lval_num(3L), lval_num(47745369192L), lval_num(14L), lval_err("%s", "invalid number"), lval_num(1411279452704L), lval_err("%s", "invalid number"), lval_num(769068421447400117L), lval_num(581L), lval_num(56289088969L), lval_num(107892L), lval_num(-151L), lval_num(-2069449L), lval_num(-25L), lval_num(1016844L), lval_num(-74698561L), lval_num(115565582L), lval_num(1129344L), lval_num(1487289611697067L), lval_num(-40972L), lval_num(-157730973845726549L), lval_num(5755186984929L), lval_num(-8742379L), lval_num(855548484609410L), lval_num(14666140L), lval_num(14860L), lval_num(-704L), lval_err("%s", "invalid number"), lval_num(-12129406L), lval_num(-96338L), lval_num(-108533841865988399L), lval_num(-4068L), lval_num(10066574404L), lval_num(32823479L), lval_num(5917L), lval_num(256545857511986304L), lval_num(105318347649134692L), lval_num(-2141577L), lval_num(3682926193742L), lval_num(62750L), lval_num(524139457L), lval_num(-2093412998351L), lval_num(-5150671341846066L), lval_num(15983696763679L), lval_num(-71982430514451504L), lval_num(-98907L), lval_num(-253305169067109809L), lval_num(-1626152L), lval_num(-588706919631L), lval_num(-162640237195998626L), lval_num(1612093833085638646L), lval_num(1294432747327434199L), lval_num(0L), lval_num(-1501L), lval_num(-1L), lval_num(-41187L), lval_num(135710692960833528L), lval_num(-7037058489124L), lval_num(119868326L), lval_num(787803700851L), lval_num(-52230633979607L), lval_num(-6L), lval_num(-3724149037L), lval_num(30L), lval_num(-31598506093517535L), lval_num(-30780589061914468L), lval_num(-15L), lval_num(-1387599L), lval_num(-60355295054421531L), lval_num(54934050717024904L), lval_num(-598213029908L), lval_num(75L), lval_num(-24358177422105L), lval_num(-2086340361L), lval_num(3L), lval_num(-82891385841670401L), lval_num(-9121L), lval_num(-799L), lval_num(-30332354L), lval_num(-3864L), lval_num(-1850490383746492L), lval_num(27L), lval_num(43L), lval_num(-46L), lval_num(-30682856774L), lval_num(857730872525L), lval_num(1268230927L), lval_num(1L), lval_num(-84401823049729L), lval_num(-6L), lval_num(1500256L), lval_num(-1L), lval_num(-491093374036226L), lval_num(-117288L), lval_num(0L), lval_num(1L), lval_num(897210715690L), lval_num(7409195025L), lval_num(2915784L), lval_num(-2865531661121079065L), lval_num(-79969729598665L), lval_num(17384L), lval_num(-17524L), lval_num(115113L), lval_num(23721108048482L), lval_num(2803385977712882201L), lval_num(676L), lval_num(-35302573L), lval_num(-232484159556L), lval_num(3615451149L), lval_num(87885685L), lval_num(14729353L), lval_num(-85L), lval_num(-1969281270806562L), lval_num(-808747856503454890L), lval_num(38465111735L), lval_num(-4L), lval_num(151770613796L), lval_num(9365599463215517L), lval_num(-606775394442812L), lval_num(-397387570L), lval_num(1354237432817L), lval_num(104145234869L), lval_num(-1460L), lval_num(169526L), lval_num(-116284L), lval_num(17373247432255L), lval_num(-16846190671744L), lval_num(-315565390622354674L), lval_num(2040812959L), lval_num(-856112649969650L), lval_num(-1412660636877344967L), lval_num(57L), lval_num(-1626103274276667L), lval_num(-32496355L), lval_num(-158258L), lval_num(-971941L), lval_num(207161167L), lval_num(-42952161582212L), lval_num(33340283L), lval_num(46287289492L), lval_err("%s", "invalid number"), lval_num(0L), lval_num(-546L), lval_num(-31328009285010L), lval_num(28633435L), lval_num(5287699L), lval_num(-185579671L), lval_num(-23337L), lval_num(1920165177699L), lval_num(21036447L), lval_num(11396637L), lval_num(-53203L), lval_num(-11L), lval_num(-1L), lval_num(-13L), lval_num(1978659183331634363L), lval_num(2141249819L), lval_err("%s", "invalid number"), lval_num(2890450484770977281L), lval_num(2012402823796280L), lval_num(0L), lval_num(-1846036578456532L), lval_num(1765740L), lval_err("%s", "invalid number"), lval_num(2255661232693874916L), lval_num(397341529L), lval_num(7159076602L), lval_num(843892542512L), lval_num(-57L), lval_num(1992271L), lval_num(8274078406033453838L), lval_num(74L), lval_num(-7068179L), lval_num(-5420L), lval_num(3345950425909590L), lval_num(20L), lval_err("%s", "invalid number"), lval_err("%s", "invalid number"), lval_num(5568780157560760013L), lval_num(117461457L), lval_num(-2608774389471018602L), lval_num(-118727197614173717L), lval_num(29949768627985L), lval_num(858726471L), lval_num(489451065055611602L), lval_num(-31212L), lval_num(-124095640L), lval_num(5L), lval_num(-5L), lval_num(24L), lval_num(-15390096606401L), lval_num(-1L), lval_num(4460536299119434L), lval_num(-1357910824669981417L), lval_num(713098986163170991L), lval_num(-4560611024648212908L), lval_num(-124281L), lval_num(-3836954172291233L), lval_num(55L), lval_num(-218715241L), lval_num(178636L), lval_num(-1534233L), lval_num(1631378421L), lval_num(-8002L), lval_num(-25870066L), lval_num(-59625L), lval_num(-127631222L), lval_num(29L), lval_num(50925947867L), lval_num(97799968806L), lval_num(127204197L), lval_num(771585L), lval_num(3794805608325224772L), lval_num(1692432338404L), lval_num(-36612L), lval_num(2L), lval_num(8065647978L), lval_num(1491934149L), lval_num(68318090307284L), lval_num(-4278023266688L), lval_num(-25769374672605811L), lval_num(10L), lval_num(-209283076L), lval_num(108L), lval_num(576550377L), lval_num(73344107781367L), lval_num(3652170512L), lval_num(545176031925408L), lval_num(-38376L), lval_num(-125834532L), lval_num(-114959906627L), lval_num(-76152294L), lval_num(1007673L), lval_num(1789245788137242296L), lval_num(384736228609474L), lval_num(-24372L), lval_num(-1372078909514L), lval_num(-4129393022961449233L), lval_num(42033129L), lval_num(-3L), lval_num(-32250L), lval_num(301372890324653L), lval_num(1591579L), lval_num(46L), lval_num(-150073027394165767L), lval_num(-111365344603L), lval_num(26527517043L), lval_num(-2288357806103418L), lval_num(86575L), lval_num(6077275L), lval_num(-8296555L), lval_num(-5375557055995515087L), lval_num(-324971384L), lval_err("%s", "invalid number"), lval_num(-50L), lval_err("%s", "invalid number"), lval_num(-1053525288896183925L), lval_num(-1469931647836L), lval_num(7L), lval_num(1762424L), lval_num(-2023L), lval_num(10314L), lval_num(281071L), lval_num(1947568252L), lval_num(-4889077494228L), lval_num(542860097746607022L), lval_num(-3626657327L), lval_num(-280L), lval_num(-3056338L), lval_num(-2135871232375L), lval_num(-29182453L), lval_num(54075773182035900L), lval_num(8570161636374749L), lval_num(-557748053491066829L), lval_num(2914429649371L), lval_num(-2L), lval_num(-623L), lval_num(-75020698264708L), lval_num(1224L), lval_num(14086308852273440L), lval_num(-123437703L), lval_num(-810L), lval_num(-19774668191218323L), lval_num(-11689559157877L), lval_num(-3925409918641167L), lval_num(30038L), lval_num(15080058472485805L), lval_num(-266352791267327L), lval_num(37362L), lval_num(816474517707579L), lval_err("%s", "invalid number"), lval_num(-611907824100476221L), lval_num(22169861238761279L), lval_num(-6349273718L), lval_num(2406L), lval_num(-104798L), lval_num(2017754L), lval_num(17538004L), lval_err("%s", "invalid number"), lval_num(-8650243086700L), lval_num(19089131510523627L), lval_num(-23945569L), lval_num(-8043125197883392L), lval_num(4028054325246419321L), lval_num(-159L), lval_err("%s", "invalid number"), lval_num(104L), lval_num(-5L), lval_num(-40764999886113571L), lval_num(2609219036681559L), lval_num(-55023026887213L), lval_err("%s", "invalid number"), lval_num(1500930260027468L), lval_num(21819874228493223L), lval_num(-32492L), lval_num(33774934528021030L), lval_num(-183553396L), lval_num(-15124481623940L), lval_num(47962384622903L), lval_num(-4289353937L), lval_num(4722197948L), lval_num(-6L), lval_num(42692L), lval_num(-370500545L), lval_num(118117917L), lval_num(4777827929760398L), lval_num(-3772737232015L), lval_num(-2123L), lval_num(16734184L), lval_num(-766335222187017L), lval_num(122147L), lval_num(-2527210758L), lval_num(-10647189718L), lval_num(51139987L), lval_num(2428750175L), lval_num(32L), lval_num(-144664777L), lval_num(24443409580918L), lval_num(-382689410098L), lval_num(1507530542L), lval_num(127L), lval_num(393816L), lval_num(27939385L), lval_num(-2090046356130276041L), lval_num(-1L), lval_num(-61630826722361807L), lval_num(10L), lval_num(8546606L), lval_num(1L), lval_num(899591677061764617L), lval_num(232L), lval_num(1002491L), lval_num(-993291055760130740L), lval_num(71412174913162L), lval_num(34L), lval_num(-37677068L), lval_num(-2520499L), lval_num(-25241751L), lval_num(133237380759L), lval_num(4502533383254993340L), lval_num(-4369445611246194L), lval_num(7719710899L), lval_num(41351534044521L), lval_num(151596530235989942L), lval_num(3099L), lval_num(870033033583391L), lval_num(31189L), lval_num(127034739125747600L), lval_num(-4165897474248749025L), lval_num(61858L), lval_num(530323930172L), lval_num(-563L), lval_num(-7157L), lval_num(131152032310583787L), lval_num(-936L), lval_num(-321974538838243L), lval_num(2L), lval_num(-41718924945L), lval_num(165877L), lval_num(17199287055485L), lval_num(278172L), lval_num(-1944530654062209L), lval_num(-132690915L), lval_num(423235426675L), lval_num(107502057462336914L), lval_num(-123900L), lval_num(3584901780576055757L), lval_num(-19929174L), lval_err("%s", "invalid number"), lval_num(-118088775794669609L), lval_num(-7207257192732321354L), lval_num(2L), lval_num(12927428377911297L), lval_num(-209482L), lval_num(-254320413L), lval_num(-3838179964720L), lval_num(-2046498636L), lval_num(-6L), lval_num(-18982400L), lval_num(33402L), lval_num(-246272189415500L), lval_num(143503262837363300L), lval_num(15212L), lval_num(-67780072873611553L), lval_num(6934824L), lval_num(1L), lval_num(-57039L), lval_err("%s", "invalid number"), lval_num(-1L), lval_num(19193873687405L), lval_num(-3056410L), lval_num(45821950048247182L), lval_num(731171365L), lval_num(577696895L), lval_num(14209155269L), lval_num(-8L), lval_num(78237525113538L), lval_num(-29943162260312L), lval_num(2769660088417L), lval_num(-281728106L), lval_num(-1820297L), lval_num(-607550571687319L), lval_num(1268759998168003L), lval_num(31285708970114058L), lval_num(-4294109335368L), lval_num(1675102030473L), lval_num(13824396794L), lval_num(236421003040632894L), lval_num(5443494703591753L), lval_num(18849L), lval_num(-2817793735664L), lval_num(-31088122L), lval_num(29378446806614L), lval_num(120689690444954L), lval_num(520110440L), lval_num(-22917078467441L), lval_num(-59588693156998985L), lval_num(1107566909193729741L), lval_num(9196179254L), lval_num(70902711723L), lval_num(-482L), lval_num(5391567381117278571L), lval_num(-254112423432367L), lval_err("%s", "invalid number"), lval_num(3463351272L), lval_num(-3113674084947094838L), lval_err("%s", "invalid number"), lval_num(29818955444276L), lval_err("%s", "invalid number"), lval_num(-29663964L), lval_num(-31L), lval_num(592379L), lval_num(21940913242292L), lval_num(90886337821L), lval_num(-25359480611954135L), lval_num(1004605257L), lval_num(3L), lval_num(-8L), lval_num(260335207L), lval_num(1245379L), lval_num(4907L), lval_num(144963549568065L), lval_num(219834060192L), lval_num(-8219828333614L), lval_num(221467999L), lval_num(-1002976L), lval_num(-3753386793L), lval_num(1605953L), lval_num(355421L), lval_num(10875619317993L), lval_num(-617L), lval_num(239101777266165532L), lval_num(-404618065L), lval_num(187638868056L), lval_num(-15698L), lval_num(3L), lval_num(-5673322475237L), lval_num(209525488959447253L), lval_num(-30446314998141L), lval_num(13420L), lval_num(-136462L), lval_num(-1135L), lval_num(-15L), lval_num(35705217223L), lval_num(-19750071L), lval_num(-87575L), lval_err("%s", "invalid number"), lval_num(12073469051L), lval_num(-795313822937L), lval_num(-43815847L), lval_num(7697L), lval_num(650957351672283L), lval_num(646997078010362700L), lval_num(-438576081253188L), lval_err("%s", "invalid number"), lval_num(-31L), lval_num(-8066718079L), lval_num(-134L), lval_num(-130821626617L), lval_num(38562415394295L), lval_num(-257L), lval_num(-158952406157L), lval_num(-638L), lval_num(-18844960903L), lval_num(316447L), lval_num(-537L), lval_num(-48412428L), lval_num(-1262024L), lval_num(-7110275196279L), lval_num(-330609L), lval_num(602L), lval_num(-37529880L), lval_err("%s", "invalid number"), lval_num(15484923L), lval_num(-2019024L), lval_num(-147L), lval_num(-1379131884076543654L), lval_num(-533402391L), lval_num(4908207127364899L), lval_num(43462846422969407L), lval_num(13270408710L), lval_num(19L), lval_num(847830L), lval_num(456596585408L), lval_num(-1609141309015L), lval_num(-123788315454L), lval_err("%s", "invalid number"), lval_num(378166L), lval_num(5L), lval_num(-252624L), lval_num(48182842779673268L), lval_num(-4474656176845498048L), lval_num(-25471886L), lval_num(21104746012413493L), lval_num(-3923382735L), lval_num(395672173L), lval_num(-17024743214943478L), lval_num(87L), lval_num(162L), lval_num(31276537616708852L), lval_num(-237002882976223L), lval_num(-6069142822L), lval_num(-911710L), lval_num(-925L), lval_num(-4917294L), lval_num(334680612198207021L), lval_num(-619315753L), lval_num(-521556824659603588L), lval_num(-5374110203605L), lval_num(3250433081L), lval_num(-12333073054L), lval_num(761L), lval_num(-51779467L), lval_num(41L), lval_num(-3380890771L), lval_num(799339621918771541L), lval_num(2649516370628L), lval_num(923509298053828L), lval_num(4088151005297814L), lval_num(35787076518L), lval_num(-109110L), lval_num(0L), lval_num(-5440697112727876786L), lval_num(859618774288267L), lval_num(1133L), lval_num(-2279843461215722092L), lval_num(4747842780130746392L), lval_num(1205422504692432454L), lval_num(7285360575796275L), lval_num(-3L), lval_num(6898682L), lval_num(82L), lval_num(-201171L), lval_num(0L), lval_num(-15540249513L), lval_err("%s", "invalid number"), lval_num(110893393083L), lval_num(915048465L), lval_num(-4581374599L), lval_num(-4440708896643989L), lval_num(132027068868L), lval_err("%s", "invalid number"), lval_num(-75229665683L), lval_num(2007227701754629L), lval_num(3306381L), lval_err("%s", "invalid number"), lval_num(-229564420769L), lval_num(-869757637709078L), lval_num(-347940009L), lval_num(1725144L), lval_num(203L), lval_num(-8700194558044486L), lval_num(-24427552486430753L), lval_num(6L), lval_num(-13L), lval_num(192338L), lval_num(-6110717820L), lval_num(188377115553L), lval_num(0L), lval_num(2L), lval_num(-10030409L), lval_num(370897L), lval_num(-513792461706L), lval_num(-1436511295167L), lval_num(175877942L), lval_num(-9L), lval_num(0L), lval_num(418526583033517L), lval_num(-23070886386L), lval_num(-84L), lval_num(4387245199854267194L), lval_num(-26559108L), lval_num(-3804665L), lval_num(3863030158L), lval_num(258695586245386L), lval_num(-78439153974778L), lval_num(365832472L), lval_num(212778244810L), lval_num(19116L), lval_num(-173099L), lval_num(109753187378L), lval_num(392L), lval_num(13013549L), lval_num(169262L), lval_num(3050810254668L), lval_num(-90L), lval_num(30358748L), lval_num(-4L), lval_num(65489358982L), lval_num(4438601648091L), lval_num(29L), lval_num(-8625817874465275L), lval_num(-897041348576L), lval_num(-12625616118037583L), lval_num(-817318785340839114L), lval_num(-218468275977691016L), lval_num(-156418484L), lval_num(-95855333699L), lval_num(24000080501283219L), lval_num(2603752L), lval_num(36979192197L), lval_num(-35950386058360L), lval_num(15628016264154L), lval_num(104009135227504651L), lval_num(-450453788L), lval_num(51654678011L), lval_num(-43266L), lval_num(-2L), lval_num(54228955087350L), lval_num(-102001765439L), lval_num(1282641011628L), lval_num(0L), lval_num(16382407332L), lval_num(-3090965277235697005L), lval_num(3L), lval_num(-4359284915279660L), lval_num(112002L), lval_num(241L), lval_num(124L), lval_num(91978921841L), lval_num(9L), lval_num(9219L), lval_num(314929485776L), lval_num(5164324522L), lval_num(-6062L), lval_num(-1523258L), lval_num(118437130L), lval_num(-133L), lval_num(119005L), lval_num(-1199078397866L), lval_num(137469875869L), lval_num(-11137L), lval_num(61219632808767L), lval_num(-956L), lval_num(2L), lval_num(-32477293710L), lval_num(143614L), lval_num(1190L), lval_num(-963L), lval_num(39496920252728492L), lval_num(7450L), lval_num(-11029L), lval_num(2L), lval_num(-1342988596296L), lval_num(-33895337797350305L), lval_num(56L), lval_num(3348679597094453L), lval_num(3010005984700756L), lval_num(2621728337459L), lval_num(-731L), lval_num(23940L), lval_num(-54787L), lval_num(12L), lval_num(3954333299826L), lval_num(-5L), lval_num(135414781375L), lval_num(-87538339L), lval_num(252641898865557286L), lval_num(526617451L), lval_num(29106064974825L), lval_num(69L), lval_num(-74L), lval_num(-40435187L), lval_num(-24239751822145L), lval_num(-214495748751735L), lval_num(2L), lval_num(334637948716855L), lval_num(-53L), lval_num(44668486405263226L), lval_num(-62291L), lval_num(-174849609584000168L), lval_num(-1072816316L), lval_err("%s", "invalid number"), lval_num(-40232517L), lval_num(-5L), lval_num(66106285275L), lval_num(439L), lval_num(1353L), lval_num(-5216214433848L), lval_num(-60L), lval_num(-287877L), lval_num(-3L), lval_num(-1039078146415889354L), lval_num(11801098244124348L), lval_num(3649L), lval_num(13326014421459L), lval_num(27716297472484460L), lval_num(395845575709L), lval_num(-274126L), lval_num(2085299148193471404L), lval_num(3161771971628977L), lval_num(-157715664767497558L), lval_num(772L), lval_num(-122223L), lval_num(-108219059L), lval_num(4L), lval_num(-4L), lval_err("%s", "invalid number"), lval_num(-776322975L), lval_num(3085095766L), lval_num(0L), lval_num(-96310561083L), lval_num(36L), lval_err("%s", "invalid number"), lval_num(2884719145L), lval_num(4276401685L), lval_num(-72050942362L), lval_num(-1556597L), lval_num(259297782934117L), lval_num(-19195179161L), lval_num(2038942972L), lval_num(8219346L), lval_num(-663812931001L), lval_num(24457582877149752L), lval_num(1L), lval_num(-4658647223189573761L), lval_num(4220L), lval_num(-29554L), lval_num(2471523636446862373L), lval_num(-226L), lval_num(312590602716L), lval_num(-3769459L), lval_num(-516499112300115L), lval_num(4743L), lval_num(-471353L), lval_num(22L), lval_num(178L), lval_num(11L), lval_num(-8267954405581L), lval_num(-336597829425978326L), lval_num(170392L), lval_num(99995988069L), lval_num(-2414L), lval_num(-2L), lval_num(-23667752824603508L), lval_num(6508851506L), lval_num(361885L), lval_num(-3706575L), lval_num(46657028067L), lval_num(7270264054241L), lval_num(-231034774L), lval_num(-245L), lval_err("%s", "invalid number"), lval_num(-836398L), lval_num(-8302314L), lval_num(-2040528074197725832L), lval_num(1887242811L), lval_num(6776L), lval_num(67903155829534L), lval_num(228401070613048L), lval_num(-130764360L), lval_num(-869060382L), lval_num(-9132864L), lval_num(205829L), lval_num(-2883844L), lval_num(-61597L), lval_num(-16434L), lval_num(238L), lval_num(9L), lval_num(1589758621511819L), lval_num(1478389866237853L), lval_num(1040771070217L), lval_num(-14074433L), lval_num(-227445L), lval_num(-541704240115814498L), lval_num(-478L), lval_num(1399L), lval_num(-1L), lval_num(1313938068623612592L), lval_num(1613953L), lval_num(-1723L), lval_err("%s", "invalid number"), lval_num(141277275851929194L), lval_num(-6768579155685L), lval_num(-126397531857580L), lval_num(1018L), lval_num(489468396346847025L), lval_num(-233L), lval_num(1162L), lval_num(-433642677004657842L), lval_num(110L), lval_num(-64373609L), lval_num(-433740787L), lval_num(-933498728959847L), lval_num(61850L), lval_num(231L), lval_num(-2226631689549946124L), lval_num(-30188823542409404L), lval_num(-2L), lval_num(-7L), lval_num(121L), lval_num(4210143630316891L), lval_num(-76118701600L), lval_num(-15848224524833588L), lval_num(-11751L), lval_num(-577376651854967765L), lval_num(48974L), lval_num(-119114046L), lval_num(224885L), lval_num(-24825335073L), lval_num(-3L), lval_num(769L), lval_num(152522063L), lval_num(-11540855877L), lval_num(-19259085750203655L), lval_num(241186141695587L), lval_num(276939148193L), lval_err("%s", "invalid number"), lval_num(-1672L), lval_num(-822544161L), lval_num(0L), lval_num(-28L), lval_num(13539049L), lval_num(-235006711552L), lval_num(-123097L), lval_num(-501876872998479L), lval_num(87193808241795288L), lval_num(-32447967745L), lval_num(-12808420270L), lval_num(-195461840625705L), lval_num(-5175626748893527873L), lval_num(-8320406551135259L), lval_num(252471254819005920L), lval_num(9154190719788564421L), lval_num(-8575573919989L), lval_num(-157106755929L), lval_num(53831616182684110L), lval_num(-508952528L), lval_num(-68974006679961L), lval_num(3988920026437410106L), lval_num(4988857355L), lval_num(-2L), lval_num(68789L), lval_num(2L), lval_num(-533215996471707L), lval_num(377372428710360906L), lval_num(-205683164859918L), lval_num(17218550L), lval_num(66418545L), lval_num(907825655L), lval_num(-981153119275365196L), lval_num(-27210817728207L), lval_num(16L), lval_num(-12554L), lval_num(-2018377462444L), lval_num(-106L), lval_num(-6L), lval_num(-4257955002656L), lval_num(-3741835420L), lval_num(-2L), lval_num(102277979839050482L), lval_num(404L), lval_num(-38558629307L), lval_num(123630L), lval_num(46545300L), lval_num(-920204626077122L), lval_num(-567564L), lval_num(85324736L), lval_num(-2774907517523288256L), lval_num(-982395594407319547L), lval_num(0L), lval_num(-1054780065309L), lval_num(-8L), lval_num(136785062669L), lval_num(-5169293L), lval_num(1417343690712L), lval_num(2L), lval_num(-572225638L), lval_num(117L), lval_num(2939636515147824L), lval_num(-50028832497L), lval_num(-16408852620304L), lval_num(-1295787235909L), lval_num(-1075520L), lval_num(-1133122707L), lval_num(0L), lval_num(106744575133469L), lval_num(-935448869630198L), lval_num(166443287965773L), lval_num(238659373L), lval_num(31L), lval_num(-12L), lval_num(-959647L), lval_num(-315134741303362L), lval_num(258380358L), lval_num(2513L), lval_num(0L), lval_num(16902674408L), lval_num(-37821863351422L), lval_num(1691475635037L), lval_num(6459399099801L), lval_num(13090876090474L), lval_num(1148002094840381373L), lval_num(-193834597L), lval_num(-987542500L), lval_num(588781L), lval_num(-4215791915573L), lval_num(-123135778641862785L), lval_num(619939518405L), lval_num(-2116L), lval_num(-9114L), lval_num(-118682959L), lval_num(45116160623L), lval_num(-1016587L), lval_num(11895983143L), lval_num(25864338511593071L), lval_num(1546872916992L), lval_num(1563937L), lval_num(-2L), lval_num(-141036138343L), lval_num(-6581080L), lval_num(-5475970558429L), lval_num(-5629L), lval_num(249375370112612L), lval_num(11642954004894189L), lval_num(604L), lval_num(-260042L), lval_num(86153090671057420L), lval_num(-6833609102264L), lval_num(2670315100966L), lval_num(-649070L), lval_num(-367L), lval_num(213285959971L), lval_num(8814487931578472024L), lval_num(-89788085L), lval_num(7L), lval_num(344739476187775L), lval_num(-192577996988L), lval_num(60487L), lval_num(-35759732680649514L), lval_num(-205438328L), lval_num(-244644860517203L), lval_num(2584466885L), lval_num(-241399005291032L), lval_num(-6992855647494417L), lval_num(-10661681533580601L), lval_num(-2894981603L), lval_num(-16L), lval_num(2801414277060122L), lval_num(-116L), lval_err("%s", "invalid number"), lval_num(2246987323L), lval_num(4785L), lval_err("%s", "invalid number"), lval_num(23453788414481962L), lval_num(3517158751265286L), lval_num(1861103L), lval_num(-17457902866L), lval_num(-5008881933896L), lval_num(55082L), lval_num(5L), lval_num(809115047L), lval_num(-4046601135886L), lval_err("%s", "invalid number"), lval_num(-4058604060L), lval_num(-1150947741098L), lval_num(-380493770655L), lval_num(1116891283672553L), lval_num(-45L), lval_num(962407998054835119L), lval_num(-29469804095262L), lval_num(-36112L), lval_num(-3305830818663L), lval_num(9404243L), lval_num(-88087525510088858L), lval_num(53352477550649074L), lval_num(-2083870306L), lval_num(152618727L), lval_num(-3041803L), lval_num(3512404583887832L), lval_num(11075205038277956L), lval_num(-16248504609979L), lval_num(1819171277L), lval_num(6459850L), lval_num(10849967779973580L), lval_num(4865731L), lval_num(132101611153022L), lval_num(-11682062389L), lval_num(277153L), lval_num(4115063082218L), lval_num(-943L), lval_num(544220832745415396L), lval_num(-1549193L), lval_num(-52809L), lval_num(844694265966518L), lval_num(-7172151802L), lval_num(627211698006551395L), lval_num(9L), lval_num(366460431776529085L), lval_num(71L), lval_num(9L), lval_num(1616962059L), lval_num(-11959890L), lval_num(-58087601468L), lval_num(-3758536393416804337L), lval_num(52745348506395L), lval_num(66877567277772L), lval_num(-3824426390053842093L), lval_num(1916426645683L), lval_num(-2754659850081486L), lval_num(-217890L), lval_num(-4246L), lval_num(432872209L), lval_num(-5635443590L), lval_num(1058096096662775642L), lval_num(-1L), lval_num(-5237646591511L), lval_num(-16928032251155L), lval_num(145L), lval_num(7703039227L), lval_num(-1013842810205L), lval_num(-19195667117L), lval_num(-13356570794663650L), lval_num(-267360978185L), lval_num(59600L), lval_num(86L), lval_num(-647277709563971876L), lval_num(-134L), lval_num(62115544894L), lval_num(-137935250659027L), lval_num(2L), lval_num(-4096367L), lval_num(-509L), lval_num(56339762951842L), lval_num(532006L), lval_num(58L), lval_num(161132L), lval_num(701884218L), lval_num(14696639464089L), lval_num(0L), lval_num(-2674610224729L), lval_num(-478371608254728619L), lval_num(-1503056423347896042L), lval_num(115923194099L), lval_num(-4592368009317109L), lval_num(-8L), lval_num(-6028L), lval_num(3796L), lval_num(-1185657941708L), lval_num(-5L), lval_num(990487L), lval_num(162174542142436954L), lval_num(-30009L), lval_num(10L), lval_num(26486187477469L), lval_num(-23668378570007047L), lval_num(-31556L), lval_num(4497438843739394016L), lval_num(-26124960764607013L), lval_num(2L), lval_num(-126726331752506028L), lval_num(-175930L), lval_num(89L), lval_num(-246851608047478L), lval_num(-8299984478992482L), lval_num(5106968721202353L), lval_num(17L), lval_num(-31L), lval_num(-4849766741203364L), lval_num(-1L), lval_num(-9162863022382047135L), lval_num(-58088L), lval_err("%s", "invalid number"), lval_num(-17L), lval_num(-1810871452L), lval_num(121982L), lval_num(-52L), lval_num(936L), lval_num(424L), lval_num(-78434743L), lval_num(-6343070687023905000L), lval_num(-6L), lval_num(64994187438959L), lval_err("%s", "invalid number"), lval_num(11203201L), lval_num(2236825L), lval_err("%s", "invalid number"), lval_num(1653357213797L), lval_num(33L), lval_num(5178328851237306603L), lval_err("%s", "invalid number"), lval_err("%s", "invalid number"), lval_num(-575904L), lval_num(68682371L), lval_num(-113900L), lval_num(-27088377446L), lval_err("%s", "invalid number"), lval_num(-2558889742615L), lval_num(1021844246343759581L), lval_num(-1849980L), lval_num(-3876821965L), lval_num(378924694348358L), lval_num(64898786902264L), lval_num(-20541506334187L), lval_num(-598L), lval_num(-1200802536L), lval_num(-10488871258L), lval_num(40790115L), lval_num(1408026959330L), lval_num(-82758912247023659L), lval_num(29L), lval_num(-52457L), lval_num(-1L), lval_num(474043L), lval_num(2210021770701563917L), lval_num(2L), lval_num(-78154847L), lval_num(2040468L), lval_num(16921844L), lval_num(277774036955827L), lval_num(3757L), lval_num(-160L), lval_num(102402611319644261L), lval_num(-19178300172294L), lval_num(-473016L), lval_num(3143165343380L), lval_num(-60723780745353L), lval_num(-21240027809834L), lval_num(-4846184L), lval_num(1601542259802279L), lval_num(2L), lval_num(-27027L), lval_num(-941314022578736L), lval_num(-1623614288523414603L), lval_num(41645182320344L), lval_num(2145849161973812L), lval_num(-71L), lval_num(-144632824L), lval_num(15705L), lval_num(568152226242228107L), lval_num(43167890L), lval_num(1L), lval_num(-2302865371312487554L), lval_num(38946816685768778L), lval_num(82L), lval_num(1228342601838L), lval_num(496297918611716L), lval_num(-13L), lval_num(27902L), lval_num(108L), lval_num(-4193930905085276475L), lval_num(3158055879L), lval_err("%s", "invalid number"), lval_num(-4L), lval_num(307354L), lval_num(-57497953499851L), lval_num(-48668914L), lval_num(-3411696520771344L), lval_num(7304183L), lval_num(-949091L), lval_num(4697352618383650126L), lval_num(-142141371010545L), lval_num(335293L), lval_num(9707605058L), lval_num(-7240606034189101241L), lval_num(82508137802L), lval_num(20722330L), lval_num(-1578157925L), lval_num(-3L), lval_num(344616L), lval_err("%s", "invalid number"), lval_num(1143L), lval_num(-2L), lval_num(-6756L), lval_num(-150825919965986631L), lval_num(-860L), lval_num(-979020316L), lval_num(-17028626209919695L), lval_num(154871328518771L), lval_num(-1409634913198L), lval_num(66234083L), lval_num(-4L), lval_num(212846420610600L), lval_num(-1044940845765L), lval_num(8635293579515L), lval_num(5338166597355L), lval_num(133885981618766L), lval_num(97017575397L), lval_num(1500764752L), lval_num(-13402963038L), lval_num(52218604649141L), lval_num(576469912810941043L), lval_num(-74830270L), lval_num(-21L), lval_num(-26010922L), lval_num(-5603L), lval_num(7281035L), lval_num(1209985613156L), lval_num(-3L), lval_num(-2816L), lval_num(-12075228278L), lval_num(2636833634105741L), lval_num(-46628L), lval_num(-14882637830321L), lval_num(-128L), lval_num(-1261742716961L), lval_num(-1L), lval_num(-2037429217130L), lval_num(-155303L), lval_num(-17L), lval_num(-4597649104L), lval_num(-164L), lval_num(-2408061304893L), lval_num(-10418516570387270L), lval_num(3386L), lval_num(-948396153228L), lval_num(22080080724699540L), lval_num(-71L), lval_num(-444079865L), lval_num(14973575L), lval_num(-1006383L), lval_num(-45161408L), lval_num(26443420983434251L), lval_num(1L), lval_num(-107652845260L), lval_num(1547198226139206L), lval_num(1239305483791L), lval_num(-20619531L), lval_num(-218875748612L), lval_num(2535031638L), lval_num(853207835567365154L), lval_num(-752277584L), lval_num(-6716406010654358L), lval_num(64L), lval_num(49503298834545833L), lval_num(23366103L), lval_num(-84229199686L), lval_num(-18571956057L), lval_num(-89L), lval_err("%s", "invalid number"), lval_num(-1433091L), lval_num(343373L), lval_num(-245L), lval_num(22475L), lval_num(-32954216L), lval_num(-258330662869L), lval_num(-7595300L), lval_num(-236494353320929L), lval_num(2460539L), lval_num(-29716603250L), lval_num(12925276173330L), lval_num(63099555465L), lval_num(-559824223598765513L), lval_num(-78509503452522L), lval_num(7812494725162456695L), lval_num(6L), lval_num(12684507030799333L), lval_num(106299657L), lval_num(23100057289950304L), lval_num(262674848799L), lval_err("%s", "invalid number"), lval_num(11351406187253L), lval_num(484384000745271251L), lval_num(0L), lval_num(0L), lval_num(113354698L), lval_num(-414L), lval_num(205261794565369335L), lval_num(-5949558344797826332L), lval_num(13L), lval_num(-179796180L), lval_num(1054573543100628L), lval_num(-58L), lval_num(-14963512950780L), lval_num(-7819074290724317L), lval_num(-2172683082629L), lval_num(1L), lval_num(-494420219L), lval_num(139262352097682L), lval_num(-24117478538919L), lval_num(-85602250L), lval_num(-235892730L), lval_num(53L), lval_num(-798682066543947L), lval_num(-183662514484821279L), lval_num(2993935565815095063L), lval_num(-1909100624412L), lval_num(151628892413939334L), lval_num(33571855637206L), lval_err("%s", "invalid number"), lval_num(-3082325083784L), lval_num(200L), lval_num(2608051262892L), lval_num(1498L), lval_num(-12827083409813198L), lval_num(-188616843583765L), lval_num(38920050043290288L), lval_num(-1L), lval_num(-48L), lval_num(-66944150526L), lval_num(-37016592669L), lval_num(-16959151802559728L), lval_num(-3769L), lval_num(-1403L), lval_num(-28101789101241787L), lval_num(-120L), lval_num(24640614670551L), lval_num(608295486449L), lval_num(-20L), lval_num(8L), lval_num(18249547L), lval_num(460961L), lval_num(-5061549L), lval_num(-27274L), lval_num(362L), lval_num(-239386472238543945L), lval_num(3088905L), lval_num(5337890830167685218L), lval_num(134677578115L), lval_num(167484534L), lval_num(-29714683L), lval_num(-91490L), lval_num(-164761L), lval_num(-643L), lval_num(8L), lval_num(1602197L), lval_num(747712093290L), lval_num(-1511L), lval_num(770L), lval_num(-747807600484874331L), lval_num(324083980391355L), lval_num(1713001L), lval_num(-4L), lval_num(-3905173682980489382L), lval_num(1953857236306L), lval_num(2757816122715095333L), lval_num(161219558344518L), lval_num(-50464L), lval_num(-1358401L), lval_num(2L), lval_num(2881L), lval_num(-297874L), lval_num(-1644014288632808320L), lval_num(4978043471080L), lval_num(109878945111L), lval_num(-5786629844679213L), lval_num(1155078921677L), lval_num(2862L), lval_num(-1681939L), lval_num(5L), lval_num(-940340999242L), lval_num(16880901370L), lval_num(3074636618582L), lval_num(-2081706L), lval_num(66965077863446L), lval_num(-2747102486208L), lval_num(-555L), lval_num(-257810185L), lval_num(6578394L), lval_num(-99932L), lval_num(-26276340L), lval_num(-425895575351926L), lval_num(-9643229027L), lval_num(-21896915532L), lval_num(-7509442748765685863L), lval_num(45904681L), lval_num(4634L), lval_num(-20453L), lval_num(13977118264L), lval_num(-2912470874068960303L), lval_num(-20686426056470L), lval_num(225586L), lval_num(4232612L), lval_num(-7987L), lval_num(426882L), lval_num(96821774284342481L), lval_num(6657566747425012973L), lval_num(-1619317L), lval_num(1940503477L), lval_num(7126L), lval_num(953647L), lval_num(4L), lval_num(-1L), lval_num(-30437074L), lval_num(-997484545650480L), lval_num(-75L), lval_num(-27798805048214388L), lval_num(-211L), lval_num(3477025040009L), lval_num(2462351038899071977L), lval_num(-26605876801648677L), lval_num(-290L), lval_num(3240166309L), lval_num(3853L), lval_num(-14427764L), lval_num(926650688046965298L), lval_num(-4L), lval_num(-28328807038796L), lval_num(-11907108L), lval_num(-7039L), lval_num(-1266L), lval_err("%s", "invalid number"), lval_num(4921471570L), lval_num(5239258014275L), lval_num(163L), lval_num(29812633L), lval_num(-50L), lval_num(-1758803025L), lval_num(54389882L), lval_num(57633L), lval_num(-1113158L), lval_num(-1L), lval_num(1866100500453L), lval_num(-8447L), lval_num(-4427635701341239L), lval_num(3263009894655L), lval_num(-134993537644L), lval_num(1551352188709199423L), lval_num(-17L), lval_num(126265771L), lval_num(1L), lval_num(-53621938700002719L), lval_num(95384711316723484L), lval_num(-144L), lval_err("%s", "invalid number"), lval_num(50482011326L), lval_num(3569821L), lval_num(346308145L), lval_num(-1840210L), lval_num(-2L), lval_num(-23868412L), lval_num(-44342638435312L), lval_num(36548124685466127L), lval_num(7857L), lval_num(-25942574800510L), lval_num(29089776L), lval_num(119759594587L), lval_num(255605209L), lval_num(-31241110856L), lval_num(177960214263995913L), lval_num(-16636780441L), lval_num(9L), lval_num(-13L), lval_num(109936468904L), lval_num(451376215193360773L), lval_num(-265198163960736L), lval_num(-450028L), lval_num(54176757507L), lval_num(-2879372565L), lval_num(-95837179477687L), lval_num(-247533572L), lval_num(202438454903905639L), lval_num(-473161620526970L), lval_num(165L), lval_num(3060007851775977L), lval_num(-1656601L), lval_num(4088373987L), lval_num(-103638685943746L), lval_num(4401165840475L), lval_num(-12036232275345429L), lval_num(-23219325441287L), lval_num(12L), lval_num(284173950656534421L), lval_num(-4069598647005867337L), lval_num(49L), lval_num(-141245318841572L), lval_num(130282923941402L), lval_num(1683L), lval_num(-742802929566229648L), lval_num(-31648662458895L), lval_num(366376042725797340L), lval_num(-22535L), lval_num(-302633340803L), lval_num(-306159044377006577L), lval_num(3511073314985L), lval_num(-18L), lval_num(-141520L), lval_num(-9515954L), lval_num(35572011L), lval_num(21873921561832L), lval_num(11460L), lval_num(-1057381863245L), lval_num(-1L), lval_num(308618777682226L), lval_num(-6722L), lval_num(8334943899004654232L), lval_num(-12404531609321L), lval_num(35531L), lval_num(866L), lval_err("%s", "invalid number"), lval_num(127600919L), lval_num(599603435590377142L), lval_num(227120602417342L), lval_num(-8022598738441L), lval_num(72L), lval_num(188660L), lval_num(0L), lval_num(1491L), lval_num(1521431698035L), lval_num(-76831328L), lval_num(-10957754L), lval_num(-2338L), lval_num(-57702293L), lval_num(-4707327L), lval_num(50923370742L), lval_num(0L), lval_num(-830292397L), lval_num(-11460114L), lval_err("%s", "invalid number"), lval_num(36088L), lval_num(62807L), lval_num(-25L), lval_num(7991L), lval_num(473L), lval_num(1047L), lval_num(845128227193738L), lval_num(-313768529707L), lval_num(13771L), lval_num(22L), lval_num(-5914366953674L), lval_num(394432L), lval_num(-469226200147L), lval_num(-34L), lval_num(-1604945L), lval_num(23718219L), lval_num(-17498133627212L), lval_num(1491799L), lval_num(306861L), lval_num(163476524L), lval_num(-4978872L), lval_num(-6574429687772543L), lval_num(924402510697725450L), lval_num(358056L), lval_num(44066L), lval_num(-150L), lval_num(23226653L), lval_num(6995888433L), lval_num(-463000006595L), lval_num(4941704859168541L), lval_num(116L), lval_num(88711L), lval_num(13386313347L), lval_num(-1969314026362182L), lval_num(-55946120961823975L), lval_num(-49006259343719L), lval_num(-14L), lval_num(-2373L), lval_num(3182099758379989377L), lval_num(5802563888L), lval_num(10427L), lval_num(-28L), lval_num(-280110644884106L), lval_num(420L), lval_num(147L), lval_num(-16053770016L), lval_num(504189346968038L), lval_num(-10L), lval_num(-95383214336L), lval_num(-6909824149L), lval_num(1743L), lval_num(24061301864798584L), lval_num(-44964460L), lval_num(5013L), lval_num(-34668105239397L), lval_num(17384736211223L), lval_num(1L), lval_num(9792391553L), lval_num(3192L), lval_num(61072371446795L), lval_num(-1862L), lval_num(-261289328L), lval_num(-7665L), lval_num(2L), lval_num(16442055662218L), lval_num(624249950L), lval_num(10L), lval_num(51204L), lval_num(2L), lval_num(-65340918836982L), lval_num(-2639066549450035L), lval_num(22L), lval_num(-48897053733L), lval_num(-5508698507L), lval_num(-789774032434838412L), lval_num(-373409L), lval_num(-501682623432L), lval_num(-30228303991L), lval_num(6L), lval_num(-1735568789L), lval_num(0L), lval_num(-5617590L), lval_err("%s", "invalid number"), lval_num(-1885497759L), lval_num(7271691L), lval_num(-313718903L), lval_num(7176L), lval_num(204006933604707939L), lval_num(144552492472L), lval_num(188878238505446L), lval_num(7196184L), lval_num(-152319L), lval_num(456L), lval_num(-17923810L), lval_num(28421304065854L), lval_num(445860713854449L), lval_num(6607L), lval_num(-12565189L), lval_num(31277L), lval_num(-358457344393L), lval_err("%s", "invalid number"), lval_num(-84444L), lval_num(-10071641L), lval_err("%s", "invalid number"), lval_num(388455856986L), lval_num(27360075396656L), lval_num(2766784627501233L), lval_num(-154L), lval_num(-25522279321414L), lval_num(-2377070225L), lval_num(2856114L), lval_num(1176615784447L), lval_num(-1308L), lval_num(-109510488L), lval_num(-356327L), lval_num(-415173919715212L), lval_num(-3691289030602L), lval_num(4065127179L), lval_num(497519136494L), lval_num(158605167256830L), lval_num(-17451622695L), lval_num(-46282532L), lval_num(-4808L), lval_num(490772609556L), lval_num(611037334820L), lval_num(786437833L), lval_num(-484037096540L), lval_num(3442376800515L), lval_num(-2L), lval_num(-121249423684637L), lval_num(-13931526L), lval_num(-359039137L), lval_num(1020L), lval_num(-40380721147L), lval_num(-28375L), lval_num(701291865486L), lval_num(266436324L), lval_num(-423L), lval_num(-94805120L), lval_num(-401442368105079L), lval_num(960526821533903L), lval_num(2353L), lval_num(23836L), lval_err("%s", "invalid number"), lval_num(-3681557467591L), lval_num(-33768302310L), lval_num(-249729573435643L), lval_num(-39726101276900L), lval_num(-33041735505627135L), lval_num(-25351818627043545L), lval_num(-7316298L), lval_num(-2209129384943572L), lval_num(20509L), lval_err("%s", "invalid number"), lval_num(561L), lval_num(-62285484L), lval_num(-238988991410L), lval_num(3845858369028L), lval_num(20053130242239115L), lval_num(-5118627411603106L), lval_num(9003904L), lval_num(1L), lval_num(12976004289L), lval_err("%s", "invalid number"), lval_num(1096243056738255L), lval_num(7L), lval_num(-403028075L), lval_num(-10020922899804L), lval_num(-1464113486687264470L), lval_num(-19522309853L), lval_num(12L), lval_num(7L), lval_num(-1204L), lval_num(1053275280L), lval_num(-2126703206891970L), lval_num(-7L), lval_num(-256725726016639L), lval_num(1995667857L), lval_num(24843L), lval_num(-13L), lval_num(-81102440024558408L), lval_num(-43495L), lval_num(-1842644710678646L), lval_num(124981606054L), lval_num(-4642245954L), lval_num(1L), lval_num(-495510180061807506L), lval_num(-29065943L), lval_num(-7675758338932L), lval_num(-14963050488048L), lval_num(-2046L), lval_num(6L), lval_num(2305526874134L), lval_num(11014831L), lval_num(-1482982527L), lval_num(89078L), lval_num(-695L), lval_num(1876L), lval_num(522880514249380294L), lval_num(-262717983L), lval_num(-7769L), lval_num(-213953881892L), lval_num(36676L), lval_num(-521555724662L), lval_num(-550681667427707319L), lval_num(51066124223L), lval_num(2581L), lval_num(-34202832424L), lval_num(118769344129237L), lval_num(24267L), lval_num(-28549L), lval_num(-1851364747L), lval_num(1190593917327901797L), lval_num(-1655544192938L), lval_num(-2073282506L), lval_num(2124927974L), lval_num(-52675081538060L), lval_num(477745783396L), lval_num(-2939277683L), lval_num(7234670663L), lval_num(-109294L), lval_num(1815812952140124213L), lval_num(107755849676L), lval_num(3973101852181295763L), lval_num(-998011763651403994L), lval_num(5276261L), lval_num(227544673L), lval_num(79218L), lval_num(3678736511074406L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
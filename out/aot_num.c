@@ -0,0 +1,83 @@
+// generated by lispyc from "/tmp/aot_num.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 23, lval_num(0L), lval_num(0L), lval_num(12L), lval_num(-12L), lval_num(1000000L), lval_num(31L), lval_num(-31L), lval_num(65535L), lval_num(10L), lval_num(-1L), lval_num(0L), lval_sym("x"), lval_num(0L), lval_sym("b2"), lval_num(1L), lval_sym("_"), lval_num(1L), lval_sym("e"), lval_fnum(0x1.f4p+9), lval_fnum(0x1.89374bc6a7efap-10), lval_fnum(-0x1.f4p+7), lval_fnum(0x1.4p+0), lval_fnum(-0x0p+0)));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 4, lval_num(9223372036854775807L), lval_num(LONG_MIN), lval_err("%s", "invalid number"), lval_err("%s", "invalid number")));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 4, lval_num(9223372036854775807L), lval_num(LONG_MIN), lval_err("%s", "invalid number"), lval_num(9223372036854775807L)));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 2, lval_num(1234567890123456789L), lval_err("%s", "invalid number")));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 9, lval_fnum(0x1.999999999999ap-4), lval_fnum(0x1.999999999999ap-3), lval_fnum(0x1.3333333333334p-2), lval_fnum(0x1.8ee90ff6c373ep+96), lval_fnum(0x1.1ccf385ebc8ap+1023), lval_err("%s", "invalid number"), lval_err("%s", "invalid number"), lval_err("%s", "invalid number"), lval_fnum(0x1p-1022)));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 11, lval_fnum(0x1.921fb54442d18p+1), lval_fnum(0x1.48p+3), lval_fnum(0x1.2a05f2p+33), lval_num(12L), lval_sym("abc"), lval_num(1L), lval_sym("__0"), lval_num(0L), lval_sym("x_1"), lval_num(1L), lval_sym("e-_5")));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
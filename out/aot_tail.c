@@ -0,0 +1,209 @@
+// generated by lispyc from "/tmp/aot_tail.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("ping")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_str("p")), lispyc_list(lval_qexpr(), 2, lval_sym("pong"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L))))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("pong")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("m")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("m"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_str("q")), lispyc_list(lval_qexpr(), 2, lval_sym("ping"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("m"), lval_num(1L))))));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("ping"), lval_num(300000L)));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("ping"), lval_num(300001L)));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("count")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("n"), lval_sym("acc")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_sym("acc")), lispyc_list(lval_qexpr(), 2, lval_sym("step"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L))))));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("step")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 3, lval_sym("count"), lval_sym("n"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lval_num(1L)))));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("count"), lval_num(300000L), lval_num(0L)));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("show")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("z")), lispyc_list(lval_qexpr(), 4, lval_sym("list"), lval_sym("z"), lval_sym("n"), lval_sym("m"))));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("mid")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("m")), lispyc_list(lval_qexpr(), 2, lval_sym("show"), lval_num(3L))));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("top")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 2, lval_sym("mid"), lval_num(2L))));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("top"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("shadow")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 2, lval_sym("show"), lval_sym("n"))));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("top2")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("n"), lval_sym("m")), lispyc_list(lval_qexpr(), 2, lval_sym("shadow"), lval_num(7L))));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("top2"), lval_num(1L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("reader")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("_")), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("q"), lval_sym("k"))));
+}
+
+static lval *
+lispyc_form15(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("writer")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("k")), lispyc_list(lval_qexpr(), 2, lval_sym("reader"), lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("q")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("k"), lval_num(2L))))));
+}
+
+static lval *
+lispyc_form16(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("writer"), lval_num(9L)));
+}
+
+static lval *
+lispyc_form17(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("tping")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("n"), lval_sym("_"), lval_sym("_")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_str("p")), lispyc_list(lval_qexpr(), 4, lval_sym("tpong"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)), lval_num(0L), lval_num(0L)))));
+}
+
+static lval *
+lispyc_form18(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("tpong")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("m"), lval_sym("_"), lval_sym("_")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("m"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_str("q")), lispyc_list(lval_qexpr(), 4, lval_sym("tping"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("m"), lval_num(1L)), lval_num(0L), lval_num(0L)))));
+}
+
+static lval *
+lispyc_form19(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("tping"), lval_num(120000L), lval_num(0L), lval_num(0L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form15());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form16());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form17());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form18());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form19());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,362 @@
+// generated by lispyc from "/tmp/aotsrc_a.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 6, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 2, lval_sym("-"), lval_num(5L)), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_num(2L), lval_fnum(0x1.cp+1)), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(7L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_num(7L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_num(4294967296L), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(9223372036854775807L), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_num(3037000500L), lval_num(3037000500L)));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("add3")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("b"), lval_sym("c")), lispyc_list(lval_qexpr(), 4, lval_sym("+"), lval_sym("a"), lval_sym("b"), lval_sym("c"))));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("add3"), lval_num(1L), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 3, lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(1L)), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lispyc_list(lval_sexpr(), 3, lval_sym("add3"), lval_num(1L), lval_num(2L)), lval_num(3L)));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("p")), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("p"));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(1L)), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(1L))), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(1L)), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(2L))));
+}
+
+// fib
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	t = l[-0] < 2L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = l[-0];
+	goto L71;
+L24:
+	if (__builtin_sub_overflow(l[-0], 1L, &s0)) { goto bail; }
+	goto L41;
+L41:
+	{
+		long a[1] = { s0 };
+		if (!lispyc_fn0(&a[0], &s0)) { goto bail; }
+	}
+	if (__builtin_sub_overflow(l[-0], 2L, &s1)) { goto bail; }
+	goto L62;
+L62:
+	{
+		long a[1] = { s1 };
+		if (!lispyc_fn0(&a[0], &s1)) { goto bail; }
+	}
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+L71:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	18, 6, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 6, 1, 0,
+	-1, 11, 24, 71, 1, 0, 12, 71, 16, 1, 0, 2, 3, 1, 41, -1,
+	1, 0, 0, 2, 7, 1, 3, 1, -1, 5, 4, 2, 1, 16, 1, 0,
+	5, 6, 3, 62, -1, 1, 0, 0, 5, 7, 1, 6, 3, -1, 5, 7,
+	4, 1, 7, 0, 8, 5, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 9, lval_num(2L), lval_sym("<"), lval_num(1L), lval_sym("-"), lval_sym("fib"), lval_num(2L), lval_sym("-"), lval_sym("fib"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("fib")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("n"), lval_num(2L)), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 2, lval_sym("fib"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L))), lispyc_list(lval_sexpr(), 2, lval_sym("fib"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(2L)))))));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("fib"), lval_num(20L)));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("l")), lispyc_list(lval_sexpr(), 4, lval_sym("list"), lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 5, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("l")), lispyc_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("l")), lispyc_list(lval_sexpr(), 3, lval_sym("join"), lval_sym("l"), lval_sym("l")), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lval_num(1L), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(1L)), lispyc_list(lval_qexpr(), 2, lval_sym("error"), lval_str("no"))));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lval_num(5L));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("x"));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("f")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("x"), lval_sym("&"), lval_sym("rest")), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("x"), lval_sym("rest"))));
+}
+
+static lval *
+lispyc_form15(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("f"), lval_num(1L)), lispyc_list(lval_sexpr(), 4, lval_sym("f"), lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form16(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 1, lval_sym("x"))), lval_num(4L)));
+}
+
+static lval *
+lispyc_form17(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lval_str("a\012b"), lval_str("q\042x"));
+}
+
+// fact
+static int
+lispyc_fn1(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	t = l[-0] == 0L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = 1L;
+	goto L52;
+L24:
+	s0 = l[-0];
+	if (__builtin_sub_overflow(l[-0], 1L, &s1)) { goto bail; }
+	goto L43;
+L43:
+	{
+		long a[1] = { s1 };
+		if (!lispyc_fn1(&a[0], &s1)) { goto bail; }
+	}
+	if (__builtin_mul_overflow(s0, s1, &s0)) { goto bail; }
+L52:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code1[] = {
+	18, 9, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 9, 1, 0,
+	-1, 11, 24, 52, 0, 2, 12, 52, 1, 0, 16, 1, 0, 3, 4, 1,
+	43, -1, 1, 0, 0, 3, 7, 1, 4, 1, -1, 5, 5, 2, 1, 7,
+	2, 6, 3, -1, 14
+};
+
+static lval *
+lispyc_consts1(void) {
+	return lispyc_list(lval_qexpr(), 7, lval_num(0L), lval_sym("=="), lval_num(1L), lval_num(1L), lval_sym("-"), lval_sym("fact"), lval_sym("*"));
+}
+
+static lval *
+lispyc_form18(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("fact")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("n"), lispyc_list(lval_sexpr(), 2, lval_sym("fact"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)))))));
+}
+
+static lval *
+lispyc_form19(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("fact"), lval_num(20L)), lispyc_list(lval_sexpr(), 2, lval_sym("fact"), lval_num(25L)));
+}
+
+static lval *
+lispyc_form20(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(1L), lval_num(0L)));
+}
+
+static lval *
+lispyc_form21(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lval_qexpr()));
+}
+
+static lval *
+lispyc_form22(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lval_fnum(0x1.8p+0), lval_num(-2L), lval_fnum(-0x1.4p+1));
+}
+
+static lval *
+lispyc_form23(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("y")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("x"), lval_sym("y")))));
+}
+
+static lval *
+lispyc_form24(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lispyc_list(lval_sexpr(), 2, lval_sym("g"), lval_num(1L)), lval_num(2L)));
+}
+
+static lval *
+lispyc_form25(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 1, lval_sym("x"))));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "fib", lispyc_code0, 72, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form15());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form16());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form17());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form18());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "fact", lispyc_code1, 53, lispyc_consts1(), lispyc_fn1);
+
+	x = lvm_eval(e, lispyc_form19());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form20());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form21());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form22());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form23());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form24());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form25());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,153 @@
+// generated by lispyc from "/tmp/aotsrc_aot_inline.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("f")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lval_qexpr()), lval_sym("x"))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("_")), lispyc_list(lval_qexpr(), 2, lval_sym("f"), lispyc_list(lval_sexpr(), 2, lval_sym("error"), lval_str("from the argument")))));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("g"), lval_num(0L)));
+}
+
+// k
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = 1L;
+	if (__builtin_sub_overflow(l[-0], 1L, &s1)) { goto bail; }
+	goto L19;
+L19:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	0, 0, 16, 1, 0, 1, 2, 0, 19, 1, 1, 0, 0, 1, 7, 1,
+	2, 0, -1, 7, 0, 3, 1, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 4, lval_num(1L), lval_num(1L), lval_sym("-"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("k")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("x"), lval_num(1L)))));
+}
+
+// h
+static int
+lispyc_fn1(long *l, long *out) {
+	long s0;
+	long s1;
+	long s2;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = 1L;
+	if (__builtin_mul_overflow(l[-0], 2L, &s1)) { goto bail; }
+	goto L34;
+L34:
+	s2 = 1L;
+	if (__builtin_sub_overflow(s1, s2, &s1)) { goto bail; }
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	goto L69;
+L69:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code1[] = {
+	10, 0, 0, 31, 48, 10, 1, 1, 12, 48, 10, 2, 2, 13, 48, 0,
+	3, 16, 2, 0, 4, 5, 3, 34, 1, 1, 0, 0, 4, 7, 2, 5,
+	3, -1, 0, 6, 7, 1, 7, 4, 1, 7, 0, 8, 5, -1, 12, 69,
+	16, 2, 0, 9, 10, 6, 65, -1, 1, 0, 0, 9, 7, 2, 10, 6,
+	-1, 6, 11, 7, 1, 14
+};
+
+static lval *
+lispyc_consts1(void) {
+	return lispyc_list(lval_qexpr(), 12, lval_sym("k"), lval_sym("+"), lval_sym("-"), lval_num(1L), lval_num(2L), lval_sym("*"), lval_num(1L), lval_sym("-"), lval_sym("+"), lval_num(2L), lval_sym("*"), lval_sym("k"));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("h")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("y")), lispyc_list(lval_qexpr(), 2, lval_sym("k"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("y"), lval_num(2L)))));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("h"), lval_num(5L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "k", lispyc_code0, 25, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "h", lispyc_code1, 70, lispyc_consts1(), lispyc_fn1);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,110 @@
+// generated by lispyc from "/tmp/aotsrc_arith.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 8, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("+"), lval_num(1L), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("-"), lval_num(5L)), lispyc_list(lval_sexpr(), 2, lval_sym("-"), lval_fnum(0x1.6p+2)), lispyc_list(lval_sexpr(), 4, lval_sym("-"), lval_num(10L), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 4, lval_sym("*"), lval_num(2L), lval_num(3L), lval_num(4L)), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(7L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_num(7L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 5, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("+"), lval_num(1L), lval_fnum(0x1.4p+1), lval_num(3L)), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_fnum(0x1p+1), lval_num(3L)), lispyc_list(lval_sexpr(), 4, lval_sym("-"), lval_num(1L), lval_fnum(0x1p-1), lval_num(1L)), lispyc_list(lval_sexpr(), 4, lval_sym("/"), lval_fnum(0x1.2p+3), lval_num(2L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 5, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(1L), lval_num(0L)), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_fnum(0x1p+0), lval_fnum(0x1p-1)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_fnum(0x1.8p+0), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_num(3L), lval_fnum(0x1p+1)));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lval_str("a")), lispyc_list(lval_sexpr(), 1, lval_sym("+")));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 7, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym(">="), lval_num(2L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("<="), lval_num(3L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_fnum(0x1.8p+0), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_num(1L), lval_fnum(0x1.8p+0)));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 6, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_num(1L), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("!="), lval_num(1L), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_num(2L)), lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_num(2L))), lispyc_list(lval_sexpr(), 3, lval_sym("!="), lval_str("a"), lval_str("b")), lispyc_list(lval_sexpr(), 2, lval_sym("=="), lval_num(1L)));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("def"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lval_num(1L), lval_num(2L));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("c")), lval_num(3L));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 6, lval_sym("print"), lval_sym("a"), lval_sym("b"), lval_sym("c"), lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 2, lval_sym("x"), lval_sym("y")), lval_num(1L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,294 @@
+// generated by lispyc from "/tmp/aotsrc_b.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("show")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("z")), lispyc_list(lval_qexpr(), 4, lval_sym("list"), lval_sym("z"), lval_sym("a"), lval_sym("b"))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("mid")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("b")), lispyc_list(lval_qexpr(), 2, lval_sym("show"), lval_num(3L))));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("top")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("a")), lispyc_list(lval_qexpr(), 2, lval_sym("mid"), lval_num(2L))));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("top"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("setter")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("a")), lispyc_list(lval_qexpr(), 3, lval_sym("do2"), lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("a")), lval_num(9L)), lispyc_list(lval_sexpr(), 2, lval_sym("show"), lval_num(0L)))));
+}
+
+// do2
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-1];
+	*out = s0;
+	ljit_depth--;
+	return 1;
+}
+
+static const int lispyc_code0[] = {
+	1, 1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lval_qexpr();
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("do2")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("x"), lval_sym("y")), lispyc_list(lval_qexpr(), 1, lval_sym("y"))));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("b")), lval_num(100L));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("setter"), lval_num(5L)));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("f1")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 2, lval_sym("f2"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("x"), lval_num(1L)))));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("f2")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("y")), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("x"), lval_sym("y"))));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("f1"), lval_num(10L)));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g1")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("x"), lval_num(0L)), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("x"), lval_sym("q")), lispyc_list(lval_qexpr(), 3, lval_sym("g2"), lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("q")), lval_sym("x")), lval_sym("x")))));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g2")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("_"), lval_sym("x")), lispyc_list(lval_qexpr(), 2, lval_sym("g1"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("x"), lval_num(1L)))));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("g1"), lval_num(3L)));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("ev")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_str("done")), lispyc_list(lval_qexpr(), 2, lval_sym("eval"), lispyc_list(lval_qexpr(), 2, lval_sym("ev"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)))))));
+}
+
+static lval *
+lispyc_form15(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("ev"), lval_num(10L)));
+}
+
+static lval *
+lispyc_form16(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(2L), lval_num(3L)))));
+}
+
+static lval *
+lispyc_form17(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("t")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form18(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("e2")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(3L), lval_num(4L)));
+}
+
+static lval *
+lispyc_form19(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lval_num(1L), lval_sym("t"), lval_sym("e2")), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lval_num(0L), lval_sym("t"), lval_sym("e2")));
+}
+
+static lval *
+lispyc_form20(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 2, lval_sym("list"), lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_num(2L))));
+}
+
+static lval *
+lispyc_form21(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_sexpr(), 4, lval_sym("list"), lval_sym("+"), lval_num(1L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form22(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lispyc_list(lval_sexpr(), 2, lval_sym("head"), lispyc_list(lval_sexpr(), 3, lval_sym("list"), lval_sym("+"), lval_sym("-"))), lval_num(5L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form23(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("k")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("&"), lval_sym("xs")), lispyc_list(lval_qexpr(), 1, lval_sym("xs"))));
+}
+
+static lval *
+lispyc_form24(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 1, lval_sym("k")), lispyc_list(lval_sexpr(), 3, lval_sym("k"), lval_num(1L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form25(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("join"), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_num(2L)), lispyc_list(lval_qexpr(), 1, lval_num(3L))));
+}
+
+static lval *
+lispyc_form26(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("x"), lval_sym("y")), lispyc_list(lval_qexpr(), 1, lval_sym("x"))));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "do2", lispyc_code0, 3, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form15());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form16());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form17());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form18());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form19());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form20());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form21());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form22());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form23());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form24());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form25());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form26());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,680 @@
+// generated by lispyc from "/tmp/aotsrc_basic.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 7, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("+"), lval_num(1L), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("-"), lval_num(5L)), lispyc_list(lval_sexpr(), 4, lval_sym("-"), lval_num(10L), lval_num(3L), lval_num(2L)), lispyc_list(lval_sexpr(), 4, lval_sym("*"), lval_num(2L), lval_num(3L), lval_num(4L)), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(7L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_num(7L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 5, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_fnum(0x1.8p+0), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_num(2L), lval_fnum(0x1.4p+1)), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(1L), lval_num(0L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_fnum(0x1.4p+2), lval_num(2L)));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 7, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("<="), lval_num(2L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym(">="), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_num(2L)), lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_num(2L))), lispyc_list(lval_sexpr(), 3, lval_sym("!="), lval_num(1L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 6, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("list"), lval_num(1L), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lispyc_list(lval_qexpr(), 3, lval_num(1L), lval_num(2L), lval_num(3L))), lispyc_list(lval_sexpr(), 2, lval_sym("tail"), lispyc_list(lval_qexpr(), 3, lval_num(1L), lval_num(2L), lval_num(3L))), lispyc_list(lval_sexpr(), 3, lval_sym("join"), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 2, lval_num(2L), lval_num(3L))), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lval_qexpr()), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lispyc_list(lval_qexpr(), 1, lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L))))));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("def"), lispyc_list(lval_qexpr(), 2, lval_sym("x"), lval_sym("y")), lval_num(10L), lval_num(20L));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lval_sym("x"), lval_sym("y"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("x"), lval_sym("y")));
+}
+
+// add
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-0];
+	s1 = l[-1];
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	1, 0, 1, 1, 7, 0, 0, 0, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 1, lval_sym("+"));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("add")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("a"), lval_sym("b"))));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("add"), lval_num(3L), lval_num(4L)));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("add3")), lispyc_list(lval_sexpr(), 2, lval_sym("add"), lval_num(3L)));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lval_sym("add3"), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(10L)));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("va")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("&"), lval_sym("rest")), lispyc_list(lval_qexpr(), 3, lval_sym("join"), lispyc_list(lval_sexpr(), 2, lval_sym("list"), lval_sym("a")), lval_sym("rest"))));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("va"), lval_num(1L), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("va"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_num(1L), lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_str("yes")), lispyc_list(lval_qexpr(), 1, lval_str("no"))), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lval_num(0L), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_num(2L))));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lval_str("s"), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_num(2L))));
+}
+
+static lval *
+lispyc_form15(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("unbound"));
+}
+
+static lval *
+lispyc_form16(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("error"), lval_str("boom")));
+}
+
+static lval *
+lispyc_form17(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 2, lval_sym("error"), lval_str("inner"))));
+}
+
+static lval *
+lispyc_form18(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_num(1L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form19(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sexpr());
+}
+
+static lval *
+lispyc_form20(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 1, lval_num(5L)));
+}
+
+static lval *
+lispyc_form21(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("b"), lispyc_list(lval_sexpr(), 2, lval_sym("c"), lval_sym("d"))));
+}
+
+// fact
+static int
+lispyc_fn1(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	t = l[-0] <= 1L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = 1L;
+	goto L52;
+L24:
+	s0 = l[-0];
+	if (__builtin_sub_overflow(l[-0], 1L, &s1)) { goto bail; }
+	goto L43;
+L43:
+	{
+		long a[1] = { s1 };
+		if (!lispyc_fn1(&a[0], &s1)) { goto bail; }
+	}
+	if (__builtin_mul_overflow(s0, s1, &s0)) { goto bail; }
+L52:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code1[] = {
+	18, 8, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 8, 1, 0,
+	-1, 11, 24, 52, 0, 2, 12, 52, 1, 0, 16, 1, 0, 3, 4, 1,
+	43, -1, 1, 0, 0, 3, 7, 1, 4, 1, -1, 5, 5, 2, 1, 7,
+	2, 6, 3, -1, 14
+};
+
+static lval *
+lispyc_consts1(void) {
+	return lispyc_list(lval_qexpr(), 7, lval_num(1L), lval_sym("<="), lval_num(1L), lval_num(1L), lval_sym("-"), lval_sym("fact"), lval_sym("*"));
+}
+
+static lval *
+lispyc_form22(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("fact")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("<="), lval_sym("n"), lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("n"), lispyc_list(lval_sexpr(), 2, lval_sym("fact"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)))))));
+}
+
+static lval *
+lispyc_form23(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("fact"), lval_num(10L)));
+}
+
+static lval *
+lispyc_form24(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("dyn")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lval_qexpr(), lispyc_list(lval_qexpr(), 1, lval_sym("zz"))));
+}
+
+static lval *
+lispyc_form25(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("outer")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("zz")), lispyc_list(lval_qexpr(), 1, lval_sym("dyn"))));
+}
+
+static lval *
+lispyc_form26(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("outer"), lval_num(42L)));
+}
+
+static lval *
+lispyc_form27(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("curry")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("f"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("f"), lval_sym("a"), lval_sym("b"))));
+}
+
+static lval *
+lispyc_form28(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("curry"), lval_sym("+"), lval_num(1L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form29(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("add"), lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form30(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("e1")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("&")), lispyc_list(lval_qexpr(), 1, lval_sym("a"))));
+}
+
+static lval *
+lispyc_form31(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("e1"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form32(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lval_str("str\012"), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_qexpr(), 1, lval_str("q"))));
+}
+
+static lval *
+lispyc_form33(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 1, lval_sym("x"))));
+}
+
+static lval *
+lispyc_form34(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("x"), lval_sym("x"))), lval_num(7L)));
+}
+
+static lval *
+lispyc_form35(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_sexpr(), 4, lval_sym("list"), lval_sym("+"), lval_num(1L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form36(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_num(1L), lval_num(2L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(1L)), lispyc_list(lval_qexpr(), 2, lval_sym("error"), lval_str("no"))));
+}
+
+static lval *
+lispyc_form37(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("lst")), lispyc_list(lval_qexpr(), 3, lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form38(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_sexpr(), 3, lval_sym("join"), lispyc_list(lval_qexpr(), 1, lval_sym("head")), lispyc_list(lval_sexpr(), 2, lval_sym("list"), lval_sym("lst")))));
+}
+
+// f0
+static int
+lispyc_fn2(long *l, long *out) {
+	long s0;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = 100L;
+	*out = s0;
+	ljit_depth--;
+	return 1;
+}
+
+static const int lispyc_code2[] = {
+	0, 0, 14
+};
+
+static lval *
+lispyc_consts2(void) {
+	return lispyc_list(lval_qexpr(), 1, lval_num(100L));
+}
+
+static lval *
+lispyc_form39(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("f0")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lval_qexpr(), lispyc_list(lval_qexpr(), 1, lval_num(100L))));
+}
+
+static lval *
+lispyc_form40(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 1, lval_sym("f0")), lval_sym("f0"));
+}
+
+static lval *
+lispyc_form41(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("f0"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form42(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("apply2")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("f"), lval_sym("x")), lispyc_list(lval_qexpr(), 2, lval_sym("f"), lispyc_list(lval_sexpr(), 2, lval_sym("f"), lval_sym("x")))));
+}
+
+static lval *
+lispyc_form43(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("apply2"), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("x"), lval_num(2L))), lval_num(5L)));
+}
+
+static lval *
+lispyc_form44(void) {
+	return lispyc_list(lval_sexpr(), 5, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("-"), lval_fnum(0x1.4p+1)), lval_fnum(0x1p+0), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_fnum(0x1.8p+0), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_num(3L), lval_fnum(0x1.4p+1)));
+}
+
+static lval *
+lispyc_form45(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 1, lval_sym("x"))), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 1, lval_sym("x")))));
+}
+
+// cnt
+static int
+lispyc_fn3(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+body:
+	t = l[-0] == 0L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = l[-1];
+	goto L62;
+L24:
+	if (__builtin_sub_overflow(l[-0], 1L, &s0)) { goto bail; }
+	goto L41;
+L41:
+	if (__builtin_add_overflow(l[-1], 1L, &s1)) { goto bail; }
+	goto L58;
+L58:
+	l[-0] = s0;
+	l[-1] = s1;
+	goto body;
+L62:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code3[] = {
+	18, 9, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 9, 1, 0,
+	-1, 11, 24, 62, 1, 1, 12, 62, 16, 1, 0, 2, 3, 1, 41, -1,
+	1, 0, 0, 2, 7, 1, 3, 1, -1, 16, 0, 1, 4, 5, 2, 58,
+	-1, 1, 1, 0, 4, 7, 0, 5, 2, -1, 6, 6, 3, 2, 14
+};
+
+static lval *
+lispyc_consts3(void) {
+	return lispyc_list(lval_qexpr(), 7, lval_num(0L), lval_sym("=="), lval_num(1L), lval_sym("-"), lval_num(1L), lval_sym("+"), lval_sym("cnt"));
+}
+
+static lval *
+lispyc_form46(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("cnt")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("n"), lval_sym("acc")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_sym("acc")), lispyc_list(lval_qexpr(), 3, lval_sym("cnt"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lval_num(1L))))));
+}
+
+static lval *
+lispyc_form47(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("cnt"), lval_num(1000L), lval_num(0L)));
+}
+
+static lval *
+lispyc_form48(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lval_num(99L));
+}
+
+static lval *
+lispyc_form49(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("x"));
+}
+
+static lval *
+lispyc_form50(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("loc")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("a")), lispyc_list(lval_qexpr(), 3, lval_sym("do2"), lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("a")), lval_num(5L)), lval_sym("a"))));
+}
+
+// do2
+static int
+lispyc_fn4(long *l, long *out) {
+	long s0;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-1];
+	*out = s0;
+	ljit_depth--;
+	return 1;
+}
+
+static const int lispyc_code4[] = {
+	1, 1, 14
+};
+
+static lval *
+lispyc_consts4(void) {
+	return lval_qexpr();
+}
+
+static lval *
+lispyc_form51(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("do2")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("p"), lval_sym("q")), lispyc_list(lval_qexpr(), 1, lval_sym("q"))));
+}
+
+static lval *
+lispyc_form52(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("loc"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form53(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_str("a"), lval_str("a")), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_num(1L), lval_fnum(0x1p+0)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "add", lispyc_code0, 10, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form15());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form16());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form17());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form18());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form19());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form20());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form21());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form22());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "fact", lispyc_code1, 53, lispyc_consts1(), lispyc_fn1);
+
+	x = lvm_eval(e, lispyc_form23());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form24());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form25());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form26());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form27());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form28());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form29());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form30());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form31());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form32());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form33());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form34());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form35());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form36());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form37());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form38());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form39());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "f0", lispyc_code2, 3, lispyc_consts2(), lispyc_fn2);
+
+	x = lvm_eval(e, lispyc_form40());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form41());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form42());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form43());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form44());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form45());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form46());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "cnt", lispyc_code3, 63, lispyc_consts3(), lispyc_fn3);
+
+	x = lvm_eval(e, lispyc_form47());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form48());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form49());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form50());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form51());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "do2", lispyc_code4, 3, lispyc_consts4(), lispyc_fn4);
+
+	x = lvm_eval(e, lispyc_form52());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form53());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,485 @@
+// generated by lispyc from "/tmp/aotsrc_c.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 8, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("+"), lval_num(1L), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("-"), lval_num(5L)), lispyc_list(lval_sexpr(), 4, lval_sym("-"), lval_num(10L), lval_num(3L), lval_num(2L)), lispyc_list(lval_sexpr(), 4, lval_sym("*"), lval_num(2L), lval_num(3L), lval_num(4L)), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(7L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_fnum(0x1.cp+2), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_num(7L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(1L), lval_num(0L)));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lval_fnum(0x1.4p+1)), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_fnum(0x1p+1), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("-"), lval_fnum(0x1.8p+0)));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 9, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_num(3L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_num(3L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym(">="), lval_num(2L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("<="), lval_num(3L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_num(1L), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("!="), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_num(2L)), lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_num(2L))), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_str("a"), lval_str("a")));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_num(3000000000L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_fnum(0x1.8p+0), lval_num(2L)));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("def"), lispyc_list(lval_qexpr(), 2, lval_sym("x"), lval_sym("y")), lval_num(10L), lval_num(20L));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lval_sym("x"), lval_sym("y"));
+}
+
+// add
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-0];
+	s1 = l[-1];
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	1, 0, 1, 1, 7, 0, 0, 0, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 1, lval_sym("+"));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("add")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("a"), lval_sym("b"))));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("add"), lval_num(1L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("add1")), lispyc_list(lval_sexpr(), 2, lval_sym("add"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("add1"), lval_num(41L)));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("add1"));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("add"), lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("v")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("&"), lval_sym("rest")), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("a"), lval_sym("rest"))));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("v"), lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form15(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("v"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form16(void) {
+	return lispyc_list(lval_sexpr(), 5, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lispyc_list(lval_qexpr(), 3, lval_num(1L), lval_num(2L), lval_num(3L))), lispyc_list(lval_sexpr(), 2, lval_sym("tail"), lispyc_list(lval_qexpr(), 3, lval_num(1L), lval_num(2L), lval_num(3L))), lispyc_list(lval_sexpr(), 3, lval_sym("join"), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 2, lval_num(2L), lval_num(3L))), lispyc_list(lval_sexpr(), 4, lval_sym("list"), lval_num(1L), lval_num(2L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form17(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form18(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lispyc_list(lval_qexpr(), 2, lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(2L)), lval_num(5L)))));
+}
+
+static lval *
+lispyc_form19(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_num(1L), lval_num(1L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(1L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(2L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form20(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_num(1L), lval_num(2L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(1L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(2L), lval_num(2L))));
+}
+
+static lval *
+lispyc_form21(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lval_num(0L), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_num(2L))));
+}
+
+// f
+static int
+lispyc_fn1(long *l, long *out) {
+	long s0;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+body:
+	t = l[-0] == 0L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = 0L;
+	goto L45;
+L24:
+	if (__builtin_sub_overflow(l[-0], 1L, &s0)) { goto bail; }
+	goto L41;
+L41:
+	l[-0] = s0;
+	goto body;
+L45:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code1[] = {
+	18, 9, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 9, 1, 0,
+	-1, 11, 24, 45, 0, 2, 12, 45, 16, 1, 0, 3, 4, 1, 41, -1,
+	1, 0, 0, 3, 7, 1, 4, 1, -1, 6, 5, 2, 1, 14
+};
+
+static lval *
+lispyc_consts1(void) {
+	return lispyc_list(lval_qexpr(), 6, lval_num(0L), lval_sym("=="), lval_num(0L), lval_num(1L), lval_sym("-"), lval_sym("f"));
+}
+
+static lval *
+lispyc_form22(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("f")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_num(0L)), lispyc_list(lval_qexpr(), 2, lval_sym("f"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L))))));
+}
+
+static lval *
+lispyc_form23(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("f"), lval_num(1000L)));
+}
+
+static lval *
+lispyc_form24(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_str("str\012\042x\042"));
+}
+
+static lval *
+lispyc_form25(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("error"), lval_str("boom")));
+}
+
+static lval *
+lispyc_form26(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("undefined_sym"));
+}
+
+static lval *
+lispyc_form27(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lval_qexpr()));
+}
+
+static lval *
+lispyc_form28(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("q")), lispyc_list(lval_qexpr(), 3, lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form29(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("q"));
+}
+
+static lval *
+lispyc_form30(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("x"), lval_num(1L))));
+}
+
+static lval *
+lispyc_form31(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("x"), lval_num(1L))), lval_num(5L)));
+}
+
+static lval *
+lispyc_form32(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lval_num(2L)));
+}
+
+static lval *
+lispyc_form33(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("g")), lispyc_list(lval_sexpr(), 4, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("y")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_num(2L))), lispyc_list(lval_qexpr(), 1, lval_sym("y"))));
+}
+
+static lval *
+lispyc_form34(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("g"), lval_num(3L)));
+}
+
+static lval *
+lispyc_form35(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("h")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("do"), lispyc_list(lval_sexpr(), 3, lval_sym("="), lispyc_list(lval_qexpr(), 1, lval_sym("y")), lval_sym("x")), lval_sym("y"))));
+}
+
+static lval *
+lispyc_form36(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form37(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_str("a"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form38(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_num(1L), lval_num(1L)), lispyc_list(lval_qexpr(), 1, lval_num(1L))));
+}
+
+static lval *
+lispyc_form39(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("b"), lispyc_list(lval_sexpr(), 2, lval_sym("c"), lval_sym("d"))));
+}
+
+static lval *
+lispyc_form40(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sexpr());
+}
+
+static lval *
+lispyc_form41(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 1, lval_num(9223372036854775807L)));
+}
+
+static lval *
+lispyc_form42(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_num(4294967296L), lval_num(1L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "add", lispyc_code0, 10, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form15());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form16());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form17());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form18());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form19());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form20());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form21());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form22());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "f", lispyc_code1, 46, lispyc_consts1(), lispyc_fn1);
+
+	x = lvm_eval(e, lispyc_form23());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form24());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form25());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form26());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form27());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form28());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form29());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form30());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form31());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form32());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form33());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form34());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form35());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form36());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form37());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form38());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form39());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form40());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form41());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form42());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,105 @@
+// generated by lispyc from "/tmp/aotsrc_curry.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+// line
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	if (__builtin_mul_overflow(l[-0], l[-2], &s0)) { goto bail; }
+	goto L17;
+L17:
+	s1 = l[-1];
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	15, 2, 0, 2, 0, 0, 17, 0, 1, 0, 1, 2, 7, 2, 0, 0,
+	-1, 1, 1, 7, 0, 1, 1, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 2, lval_sym("*"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("line")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("m"), lval_sym("c"), lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("m"), lval_sym("x")), lval_sym("c"))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("apply-all")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("fs"), lval_sym("x"), lval_sym("acc")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("fs"), lval_qexpr()), lispyc_list(lval_qexpr(), 1, lval_sym("acc")), lispyc_list(lval_qexpr(), 4, lval_sym("apply-all"), lispyc_list(lval_sexpr(), 2, lval_sym("tail"), lval_sym("fs")), lval_sym("x"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lispyc_list(lval_sexpr(), 2, lispyc_list(lval_sexpr(), 2, lval_sym("eval"), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lval_sym("fs"))), lval_sym("x")))))));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("fs")), lispyc_list(lval_sexpr(), 5, lval_sym("list"), lispyc_list(lval_sexpr(), 3, lval_sym("line"), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("line"), lval_num(3L), lval_num(4L)), lispyc_list(lval_sexpr(), 3, lval_sym("line"), lval_num(5L), lval_num(6L)), lispyc_list(lval_sexpr(), 3, lval_sym("line"), lval_num(7L), lval_num(8L))));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("loop")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("n"), lval_sym("acc")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_sym("acc")), lispyc_list(lval_qexpr(), 3, lval_sym("loop"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)), lispyc_list(lval_sexpr(), 4, lval_sym("+"), lval_sym("acc"), lispyc_list(lval_sexpr(), 4, lval_sym("apply-all"), lval_sym("fs"), lval_sym("n"), lval_num(0L)), lispyc_list(lval_sexpr(), 3, lispyc_list(lval_sexpr(), 2, lval_sym("line"), lval_sym("n")), lval_num(1L), lval_num(2L)))))));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("loop"), lval_num(20000L), lval_num(0L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "line", lispyc_code0, 25, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,38 @@
+// generated by lispyc from "/tmp/aotsrc_d3.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(1L), lval_num(0L))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))))));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,84 @@
+// generated by lispyc from "/tmp/aotsrc_d5.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lval_num(7L));
+}
+
+// inc
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-0];
+	s1 = 1L;
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	1, 0, 0, 0, 7, 0, 1, 0, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_sym("+"));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("inc")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("n"), lval_num(1L))));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lispyc_list(lval_sexpr(), 2, lval_sym("inc"), lval_sym("x"))))))))))))))))))))));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "inc", lispyc_code0, 10, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
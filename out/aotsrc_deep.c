@@ -0,0 +1,93 @@
+// generated by lispyc from "/tmp/aotsrc_deep.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+// count
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	t = l[-0] == 0L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = 0L;
+	goto L52;
+L24:
+	s0 = 1L;
+	if (__builtin_sub_overflow(l[-0], 1L, &s1)) { goto bail; }
+	goto L43;
+L43:
+	{
+		long a[1] = { s1 };
+		if (!lispyc_fn0(&a[0], &s1)) { goto bail; }
+	}
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+L52:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	18, 9, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 9, 1, 0,
+	-1, 11, 24, 52, 0, 2, 12, 52, 0, 3, 16, 1, 0, 4, 5, 1,
+	43, -1, 1, 0, 0, 4, 7, 1, 5, 1, -1, 5, 6, 2, 1, 7,
+	0, 7, 3, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 8, lval_num(0L), lval_sym("=="), lval_num(0L), lval_num(1L), lval_num(1L), lval_sym("-"), lval_sym("count"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("count")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_num(0L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 2, lval_sym("count"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)))))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("count"), lval_num(80000L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "count", lispyc_code0, 53, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,128 @@
+// generated by lispyc from "/tmp/aotsrc_e.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_str("a"));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("head"), lval_qexpr());
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(1L), lval_num(0L));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_str("b"));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("f")), lispyc_list(lval_sexpr(), 2, lval_sym("memo"), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 3, lval_sym("do"), lispyc_list(lval_sexpr(), 3, lval_sym("print"), lval_str("miss"), lval_sym("n")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("n"), lval_num(2L))))));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("do")), lispyc_list(lval_sexpr(), 4, lval_sym("\134"), lval_sym("&"), lval_sym("xs"), lispyc_list(lval_qexpr(), 2, lval_sym("eval"), lispyc_list(lval_sexpr(), 3, lval_sym("cons"), lispyc_list(lval_qexpr(), 1, lval_sym("list")), lval_sym("xs")))));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("f"), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("f"), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("f"), lval_num(4L)));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 5, lval_sym("loop"), lispyc_list(lval_qexpr(), 2, lval_sym("i"), lval_sym("a")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_sym("a")), lispyc_list(lval_qexpr(), 3, lval_sym("recur"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("i"), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("a"), lval_sym("i")))), lval_num(10L), lval_num(0L)));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("recur"), lval_num(1L));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 6, lval_sym("+"), lval_num(31L), lval_num(5L), lval_num(1000L), lval_fnum(0x1.f4p+9), lval_num(-16L)));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lval_num(9223372036854775807L), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_num(9223372036854775807L), lval_num(1L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,426 @@
+// generated by lispyc from "/tmp/aotsrc_f.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("sq")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 2, lval_sym("do-print"), lval_sym("x"))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("calls")), lval_num(0L));
+}
+
+// slow
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-0];
+	s1 = 1L;
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	1, 0, 0, 0, 7, 0, 1, 0, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_sym("+"));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("slow")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("x"), lval_num(1L))));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("m")), lispyc_list(lval_sexpr(), 2, lval_sym("memo"), lval_sym("slow")));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 6, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("m"), lval_num(1L)), lispyc_list(lval_sexpr(), 2, lval_sym("m"), lval_num(1L)), lispyc_list(lval_sexpr(), 2, lval_sym("m"), lval_num(2L)), lispyc_list(lval_sexpr(), 2, lval_sym("m"), lval_fnum(0x1p+0)), lispyc_list(lval_sexpr(), 2, lval_sym("m"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("lst")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("l")), lispyc_list(lval_qexpr(), 2, lval_sym("head"), lval_sym("l"))));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("ml")), lispyc_list(lval_sexpr(), 2, lval_sym("memo"), lval_sym("lst")));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("ml"), lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_num(2L))), lispyc_list(lval_sexpr(), 2, lval_sym("ml"), lispyc_list(lval_qexpr(), 2, lval_num(1L), lval_num(2L))), lispyc_list(lval_sexpr(), 2, lval_sym("ml"), lispyc_list(lval_qexpr(), 2, lval_num(3L), lval_num(4L))));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("m2")), lispyc_list(lval_sexpr(), 3, lval_sym("memo"), lval_sym("slow"), lval_num(2L)));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 6, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("m2"), lval_num(1L)), lispyc_list(lval_sexpr(), 2, lval_sym("m2"), lval_num(2L)), lispyc_list(lval_sexpr(), 2, lval_sym("m2"), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lval_sym("m2"), lval_num(1L)), lispyc_list(lval_sexpr(), 2, lval_sym("m2"), lval_num(2L)));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("memo"), lval_sym("slow"), lval_num(0L)));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("memo"), lval_sym("slow"), lval_num(-1L)));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("memo"), lval_sym("+")));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("memo"), lval_num(5L)));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("memo"), lval_sym("slow"), lval_num(1L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form15(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("add3")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("b"), lval_sym("c")), lispyc_list(lval_qexpr(), 4, lval_sym("+"), lval_sym("a"), lval_sym("b"), lval_sym("c"))));
+}
+
+static lval *
+lispyc_form16(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("p1")), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form17(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("p2")), lispyc_list(lval_sexpr(), 2, lval_sym("p1"), lval_num(2L)));
+}
+
+static lval *
+lispyc_form18(void) {
+	return lispyc_list(lval_sexpr(), 7, lval_sym("print"), lval_sym("p1"), lval_sym("p2"), lispyc_list(lval_sexpr(), 2, lval_sym("p2"), lval_num(3L)), lispyc_list(lval_sexpr(), 3, lval_sym("p1"), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 2, lispyc_list(lval_sexpr(), 2, lval_sym("p1"), lval_num(5L)), lval_num(6L)), lispyc_list(lval_sexpr(), 4, lval_sym("p1"), lval_num(1L), lval_num(1L), lval_num(1L)));
+}
+
+static lval *
+lispyc_form19(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("p1"), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(1L))), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("p1"), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(2L))));
+}
+
+static lval *
+lispyc_form20(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("ma")), lispyc_list(lval_sexpr(), 2, lval_sym("memo"), lval_sym("add3")));
+}
+
+static lval *
+lispyc_form21(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("mp")), lispyc_list(lval_sexpr(), 2, lval_sym("ma"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form22(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("mp"), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 3, lval_sym("mp"), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form23(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("mpm")), lispyc_list(lval_sexpr(), 2, lval_sym("memo"), lispyc_list(lval_sexpr(), 2, lval_sym("add3"), lval_num(1L))));
+}
+
+static lval *
+lispyc_form24(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("mpm"));
+}
+
+static lval *
+lispyc_form25(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("v")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("&"), lval_sym("r")), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("a"), lval_sym("r"))));
+}
+
+static lval *
+lispyc_form26(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("pv")), lispyc_list(lval_sexpr(), 1, lval_sym("v")));
+}
+
+static lval *
+lispyc_form27(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lval_sym("pv"), lispyc_list(lval_sexpr(), 4, lval_sym("pv"), lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form28(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("pv2")), lispyc_list(lval_sexpr(), 2, lval_sym("v"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form29(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lval_sym("pv2"));
+}
+
+static lval *
+lispyc_form30(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 5, lval_sym("loop"), lispyc_list(lval_qexpr(), 2, lval_sym("i"), lval_sym("acc")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_sym("acc")), lispyc_list(lval_qexpr(), 3, lval_sym("recur"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("i"), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lval_sym("i")))), lval_num(10L), lval_num(0L)));
+}
+
+static lval *
+lispyc_form31(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("loop"), lispyc_list(lval_qexpr(), 1, lval_sym("i")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_num(0L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 2, lval_sym("recur"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("i"), lval_num(1L))))), lval_num(10L)));
+}
+
+static lval *
+lispyc_form32(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("recur"), lval_num(1L)));
+}
+
+static lval *
+lispyc_form33(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("lp")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("loop"), lispyc_list(lval_qexpr(), 1, lval_sym("i")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_sym("n")), lispyc_list(lval_qexpr(), 1, lval_sym("i")), lispyc_list(lval_qexpr(), 2, lval_sym("recur"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("i"), lval_num(1L)))), lval_num(0L))));
+}
+
+static lval *
+lispyc_form34(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("lp"), lval_num(5L)));
+}
+
+static lval *
+lispyc_form35(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("loop"), lispyc_list(lval_qexpr(), 1, lval_sym("i")), lispyc_list(lval_qexpr(), 1, lval_sym("i"))));
+}
+
+static lval *
+lispyc_form36(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("loop"), lispyc_list(lval_qexpr(), 1, lval_sym("i")), lispyc_list(lval_qexpr(), 1, lval_sym("recur")), lval_num(1L)));
+}
+
+static lval *
+lispyc_form37(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("loop"), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("x"), lval_num(3L)), lispyc_list(lval_qexpr(), 1, lval_sym("x")), lispyc_list(lval_qexpr(), 2, lval_sym("recur"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_fnum(0x1.4p+1)))), lval_num(1L)));
+}
+
+static lval *
+lispyc_form38(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 6, lval_sym("loop"), lispyc_list(lval_qexpr(), 3, lval_sym("x"), lval_sym("&"), lval_sym("r")), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lval_sym("x"), lval_sym("r")), lval_num(1L), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form39(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("body")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("i"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_sym("acc")), lispyc_list(lval_qexpr(), 3, lval_sym("recur"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("i"), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lval_sym("i")))));
+}
+
+static lval *
+lispyc_form40(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 5, lval_sym("loop"), lispyc_list(lval_qexpr(), 2, lval_sym("i"), lval_sym("acc")), lval_sym("body"), lval_num(5L), lval_num(0L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "slow", lispyc_code0, 10, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form15());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form16());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form17());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form18());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form19());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form20());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form21());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form22());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form23());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form24());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form25());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form26());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form27());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form28());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form29());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form30());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form31());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form32());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form33());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form34());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form35());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form36());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form37());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form38());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form39());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form40());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,511 @@
+// generated by lispyc from "/tmp/aotsrc_h.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+// fd
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	long s2;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+body:
+	t = l[-2] == 0L;
+	if (t) { goto L20; }
+	goto L61;
+L20:
+	if (l[-1] == 0 || l[-1] == -1) { goto bail; }
+	s0 = l[-0] / l[-1];
+	goto L37;
+L37:
+	if (l[-1] == 0 || l[-1] == -1) { goto bail; }
+	s1 = l[-0] % l[-1];
+	goto L54;
+L54:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	goto L86;
+L61:
+	s0 = l[-0];
+	s1 = l[-1];
+	if (__builtin_sub_overflow(l[-2], 1L, &s2)) { goto bail; }
+	goto L82;
+L82:
+	l[-0] = s0;
+	l[-1] = s1;
+	l[-2] = s2;
+	goto body;
+L86:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	18, 9, 2, 0, 1, 0, 20, 61, 1, 2, 0, 0, 7, 9, 1, 0,
+	-1, 11, 61, 86, 15, 3, 0, 1, 2, 1, 37, 0, 1, 0, 1, 1,
+	7, 3, 2, 1, -1, 15, 4, 0, 1, 3, 2, 54, 1, 1, 0, 1,
+	1, 7, 4, 3, 2, -1, 7, 0, 4, 3, -1, 12, 86, 1, 0, 1,
+	1, 16, 1, 2, 5, 6, 4, 82, -1, 1, 2, 0, 5, 7, 1, 6,
+	4, -1, 6, 7, 5, 3, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 8, lval_num(0L), lval_sym("=="), lval_sym("/"), lval_sym("%"), lval_sym("+"), lval_num(1L), lval_sym("-"), lval_sym("fd"));
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("fd")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("b"), lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lispyc_list(lval_sexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_sym("a"), lval_sym("b")))), lispyc_list(lval_qexpr(), 4, lval_sym("fd"), lval_sym("a"), lval_sym("b"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L))))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 7, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(7L), lval_num(2L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(-7L), lval_num(2L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(7L), lval_num(-2L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(-9223372036854775807L), lval_num(-1L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(5L), lval_num(0L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(7L), lval_fnum(0x1p+1), lval_num(100L)));
+}
+
+// sum
+static int
+lispyc_fn1(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+body:
+	t = l[-0] <= 0L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = l[-1];
+	goto L62;
+L24:
+	if (__builtin_sub_overflow(l[-0], 1L, &s0)) { goto bail; }
+	goto L41;
+L41:
+	if (__builtin_add_overflow(l[-1], l[-0], &s1)) { goto bail; }
+	goto L58;
+L58:
+	l[-0] = s0;
+	l[-1] = s1;
+	goto body;
+L62:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code1[] = {
+	18, 8, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 8, 1, 0,
+	-1, 11, 24, 62, 1, 1, 12, 62, 16, 1, 0, 2, 3, 1, 41, -1,
+	1, 0, 0, 2, 7, 1, 3, 1, -1, 15, 0, 1, 0, 4, 2, 58,
+	-1, 1, 1, 1, 0, 7, 0, 4, 2, -1, 6, 5, 3, 2, 14
+};
+
+static lval *
+lispyc_consts1(void) {
+	return lispyc_list(lval_qexpr(), 6, lval_num(0L), lval_sym("<="), lval_num(1L), lval_sym("-"), lval_sym("+"), lval_sym("sum"));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("sum")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("n"), lval_sym("acc")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("<="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_sym("acc")), lispyc_list(lval_qexpr(), 3, lval_sym("sum"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lval_sym("n"))))));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("sum"), lval_num(100L), lval_num(0L)), lispyc_list(lval_sexpr(), 3, lval_sym("sum"), lval_num(100000L), lval_num(0L)), lispyc_list(lval_sexpr(), 3, lval_sym("sum"), lval_num(10L), lval_num(9223372036854775800L)));
+}
+
+// cmp
+static int
+lispyc_fn2(long *l, long *out) {
+	long s0;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	t = l[-0] > l[-1];
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = 1L;
+	goto L50;
+L24:
+	t = l[-0] < l[-1];
+	if (t) { goto L44; }
+	goto L48;
+L44:
+	s0 = -1L;
+	goto L50;
+L48:
+	s0 = 0L;
+L50:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code2[] = {
+	17, 5, 0, 1, 0, 0, 20, 24, 1, 0, 1, 1, 7, 5, 0, 0,
+	-1, 11, 24, 50, 0, 1, 12, 50, 17, 6, 0, 1, 2, 1, 44, 48,
+	1, 0, 1, 1, 7, 6, 2, 1, -1, 11, 48, 50, 0, 3, 12, 50,
+	0, 4, 14
+};
+
+static lval *
+lispyc_consts2(void) {
+	return lispyc_list(lval_qexpr(), 5, lval_sym(">"), lval_num(1L), lval_sym("<"), lval_num(-1L), lval_num(0L));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("cmp")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym(">"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 1, lval_num(-1L)), lispyc_list(lval_qexpr(), 1, lval_num(0L))))));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 5, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("cmp"), lval_num(1L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("cmp"), lval_num(5000000000L), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("cmp"), lval_num(-5000000000L), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("cmp"), lval_num(3L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("k")), lval_num(0L));
+}
+
+// count
+static int
+lispyc_fn3(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	t = l[-0] == 0L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = 0L;
+	goto L52;
+L24:
+	s0 = 1L;
+	if (__builtin_sub_overflow(l[-0], 1L, &s1)) { goto bail; }
+	goto L43;
+L43:
+	{
+		long a[1] = { s1 };
+		if (!lispyc_fn3(&a[0], &s1)) { goto bail; }
+	}
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+L52:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code3[] = {
+	18, 9, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 9, 1, 0,
+	-1, 11, 24, 52, 0, 2, 12, 52, 0, 3, 16, 1, 0, 4, 5, 1,
+	43, -1, 1, 0, 0, 4, 7, 1, 5, 1, -1, 5, 6, 2, 1, 7,
+	0, 7, 3, -1, 14
+};
+
+static lval *
+lispyc_consts3(void) {
+	return lispyc_list(lval_qexpr(), 8, lval_num(0L), lval_sym("=="), lval_num(0L), lval_num(1L), lval_num(1L), lval_sym("-"), lval_sym("count"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("count")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_num(0L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_num(1L), lispyc_list(lval_sexpr(), 2, lval_sym("count"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)))))));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("count"), lval_num(5L)), lispyc_list(lval_sexpr(), 2, lval_sym("count"), lval_num(20000L)), lispyc_list(lval_sexpr(), 2, lval_sym("count"), lval_num(99000L)));
+}
+
+// ack
+static int
+lispyc_fn4(long *l, long *out) {
+	long s0;
+	long s1;
+	long s2;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+body:
+	t = l[-0] == 0L;
+	if (t) { goto L20; }
+	goto L31;
+L20:
+	s0 = l[-1];
+	s1 = 1L;
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	goto L120;
+L31:
+	t = l[-1] == 0L;
+	if (t) { goto L51; }
+	goto L76;
+L51:
+	if (__builtin_sub_overflow(l[-0], 1L, &s0)) { goto bail; }
+	goto L68;
+L68:
+	s1 = 1L;
+	l[-0] = s0;
+	l[-1] = s1;
+	goto body;
+L76:
+	if (__builtin_sub_overflow(l[-0], 1L, &s0)) { goto bail; }
+	goto L93;
+L93:
+	s1 = l[-0];
+	if (__builtin_sub_overflow(l[-1], 1L, &s2)) { goto bail; }
+	goto L112;
+L112:
+	{
+		long a[2] = { s2, s1 };
+		if (!lispyc_fn4(&a[1], &s1)) { goto bail; }
+	}
+	l[-0] = s0;
+	l[-1] = s1;
+	goto body;
+L120:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code4[] = {
+	18, 9, 0, 0, 1, 0, 20, 31, 1, 0, 0, 0, 7, 9, 1, 0,
+	-1, 11, 31, 120, 1, 1, 0, 2, 7, 0, 3, 1, -1, 12, 120, 18,
+	9, 1, 4, 5, 2, 51, 76, 1, 1, 0, 4, 7, 9, 5, 2, -1,
+	11, 76, 120, 16, 1, 0, 6, 7, 3, 68, -1, 1, 0, 0, 6, 7,
+	1, 7, 3, -1, 0, 8, 6, 9, 4, 2, 12, 120, 16, 1, 0, 10,
+	11, 5, 93, -1, 1, 0, 0, 10, 7, 1, 11, 5, -1, 1, 0, 16,
+	1, 1, 12, 13, 6, 112, -1, 1, 1, 0, 12, 7, 1, 13, 6, -1,
+	5, 14, 7, 2, 6, 15, 8, 2, 14
+};
+
+static lval *
+lispyc_consts4(void) {
+	return lispyc_list(lval_qexpr(), 16, lval_num(0L), lval_sym("=="), lval_num(1L), lval_sym("+"), lval_num(0L), lval_sym("=="), lval_num(1L), lval_sym("-"), lval_num(1L), lval_sym("ack"), lval_num(1L), lval_sym("-"), lval_num(1L), lval_sym("-"), lval_sym("ack"), lval_sym("ack"));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("ack")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("m"), lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("m"), lval_num(0L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lval_sym("n"), lval_num(1L)), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 3, lval_sym("ack"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("m"), lval_num(1L)), lval_num(1L)), lispyc_list(lval_qexpr(), 3, lval_sym("ack"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("m"), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("ack"), lval_sym("m"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L))))))));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("ack"), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 3, lval_sym("ack"), lval_num(3L), lval_num(4L)));
+}
+
+// fib
+static int
+lispyc_fn5(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	t = l[-0] < 2L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = l[-0];
+	goto L71;
+L24:
+	if (__builtin_sub_overflow(l[-0], 1L, &s0)) { goto bail; }
+	goto L41;
+L41:
+	{
+		long a[1] = { s0 };
+		if (!lispyc_fn5(&a[0], &s0)) { goto bail; }
+	}
+	if (__builtin_sub_overflow(l[-0], 2L, &s1)) { goto bail; }
+	goto L62;
+L62:
+	{
+		long a[1] = { s1 };
+		if (!lispyc_fn5(&a[0], &s1)) { goto bail; }
+	}
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+L71:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code5[] = {
+	18, 6, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 6, 1, 0,
+	-1, 11, 24, 71, 1, 0, 12, 71, 16, 1, 0, 2, 3, 1, 41, -1,
+	1, 0, 0, 2, 7, 1, 3, 1, -1, 5, 4, 2, 1, 16, 1, 0,
+	5, 6, 3, 62, -1, 1, 0, 0, 5, 7, 1, 6, 3, -1, 5, 7,
+	4, 1, 7, 0, 8, 5, -1, 14
+};
+
+static lval *
+lispyc_consts5(void) {
+	return lispyc_list(lval_qexpr(), 9, lval_num(2L), lval_sym("<"), lval_num(1L), lval_sym("-"), lval_sym("fib"), lval_num(2L), lval_sym("-"), lval_sym("fib"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("fib")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("n"), lval_num(2L)), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 2, lval_sym("fib"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L))), lispyc_list(lval_sexpr(), 2, lval_sym("fib"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(2L)))))));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("fib"), lval_num(24L)));
+}
+
+// +
+static int
+lispyc_fn6(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	s0 = l[-0];
+	s1 = l[-1];
+	if (__builtin_sub_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code6[] = {
+	1, 0, 1, 1, 7, 1, 0, 0, -1, 14
+};
+
+static lval *
+lispyc_consts6(void) {
+	return lispyc_list(lval_qexpr(), 1, lval_sym("-"));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("+")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("-"), lval_sym("a"), lval_sym("b"))));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("fib"), lval_num(10L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "fd", lispyc_code0, 87, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "sum", lispyc_code1, 63, lispyc_consts1(), lispyc_fn1);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "cmp", lispyc_code2, 51, lispyc_consts2(), lispyc_fn2);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "count", lispyc_code3, 53, lispyc_consts3(), lispyc_fn3);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "ack", lispyc_code4, 121, lispyc_consts4(), lispyc_fn4);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "fib", lispyc_code5, 72, lispyc_consts5(), lispyc_fn5);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "+", lispyc_code6, 10, lispyc_consts6(), lispyc_fn6);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,132 @@
+// generated by lispyc from "/tmp/aotsrc_h2.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+// fd
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	long s2;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+body:
+	t = l[-2] == 0L;
+	if (t) { goto L20; }
+	goto L61;
+L20:
+	if (l[-1] == 0 || l[-1] == -1) { goto bail; }
+	s0 = l[-0] / l[-1];
+	goto L37;
+L37:
+	if (l[-1] == 0 || l[-1] == -1) { goto bail; }
+	s1 = l[-0] % l[-1];
+	goto L54;
+L54:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	goto L86;
+L61:
+	s0 = l[-0];
+	s1 = l[-1];
+	if (__builtin_sub_overflow(l[-2], 1L, &s2)) { goto bail; }
+	goto L82;
+L82:
+	l[-0] = s0;
+	l[-1] = s1;
+	l[-2] = s2;
+	goto body;
+L86:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	18, 9, 2, 0, 1, 0, 20, 61, 1, 2, 0, 0, 7, 9, 1, 0,
+	-1, 11, 61, 86, 15, 3, 0, 1, 2, 1, 37, 0, 1, 0, 1, 1,
+	7, 3, 2, 1, -1, 15, 4, 0, 1, 3, 2, 54, 1, 1, 0, 1,
+	1, 7, 4, 3, 2, -1, 7, 0, 4, 3, -1, 12, 86, 1, 0, 1,
+	1, 16, 1, 2, 5, 6, 4, 82, -1, 1, 2, 0, 5, 7, 1, 6,
+	4, -1, 6, 7, 5, 3, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 8, lval_num(0L), lval_sym("=="), lval_sym("/"), lval_sym("%"), lval_sym("+"), lval_num(1L), lval_sym("-"), lval_sym("fd"));
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("fd")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("a"), lval_sym("b"), lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lispyc_list(lval_sexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_sym("a"), lval_sym("b")))), lispyc_list(lval_qexpr(), 4, lval_sym("fd"), lval_sym("a"), lval_sym("b"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L))))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 7, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(7L), lval_num(2L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(-7L), lval_num(2L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(7L), lval_num(-2L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(-9223372036854775807L), lval_num(-1L), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(7L), lval_fnum(0x1p+1), lval_num(100L)), lispyc_list(lval_sexpr(), 4, lval_sym("fd"), lval_num(-9223372036854775807L), lval_num(1L), lval_num(100L)));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 5, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(-9223372036854775807L), lval_num(-1L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_num(-7L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lispyc_list(lval_sexpr(), 4, lval_sym("-"), lval_num(0L), lval_num(9223372036854775807L), lval_num(1L)), lval_num(-1L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lispyc_list(lval_sexpr(), 4, lval_sym("-"), lval_num(0L), lval_num(9223372036854775807L), lval_num(1L)), lval_num(-1L)));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("-"), lispyc_list(lval_sexpr(), 4, lval_sym("-"), lval_num(0L), lval_num(9223372036854775807L), lval_num(1L))));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 4, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_num(1L), lval_fnum(0x0p+0)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_fnum(0x1.6p+2), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("%"), lval_num(5L), lval_fnum(0x1.4p+1)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "fd", lispyc_code0, 87, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
@@ -0,0 +1,504 @@
+// generated by lispyc from "/tmp/aotsrc_scratch.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+// poly
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	if (__builtin_mul_overflow(l[-0], l[-1], &s0)) { goto bail; }
+	goto L17;
+L17:
+	if (__builtin_mul_overflow(l[-2], l[-3], &s1)) { goto bail; }
+	goto L34;
+L34:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	15, 2, 0, 1, 0, 0, 17, 0, 1, 0, 1, 1, 7, 2, 0, 0,
+	-1, 15, 2, 2, 3, 1, 1, 34, 1, 1, 2, 1, 3, 7, 2, 1,
+	1, -1, 7, 0, 2, 2, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("*"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("poly")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 4, lval_sym("a"), lval_sym("b"), lval_sym("c"), lval_sym("d")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("c"), lval_sym("d")))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 5, lval_sym("poly"), lval_num(2L), lval_num(3L), lval_num(4L), lval_num(5L)));
+}
+
+// deep
+static int
+lispyc_fn1(long *l, long *out) {
+	long s0;
+	long s1;
+	long s2;
+	long s3;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	if (__builtin_mul_overflow(l[-0], l[-1], &s0)) { goto bail; }
+	goto L17;
+L17:
+	if (__builtin_mul_overflow(l[-2], l[-3], &s1)) { goto bail; }
+	goto L34;
+L34:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	if (__builtin_mul_overflow(l[-0], l[-3], &s1)) { goto bail; }
+	goto L56;
+L56:
+	if (__builtin_mul_overflow(l[-1], l[-2], &s2)) { goto bail; }
+	goto L73;
+L73:
+	s3 = 1L;
+	if (__builtin_sub_overflow(s2, s3, &s2)) { goto bail; }
+	if (__builtin_add_overflow(s1, s2, &s1)) { goto bail; }
+	if (__builtin_sub_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code1[] = {
+	15, 2, 0, 1, 0, 0, 17, 0, 1, 0, 1, 1, 7, 2, 0, 0,
+	-1, 15, 2, 2, 3, 1, 1, 34, 1, 1, 2, 1, 3, 7, 2, 1,
+	1, -1, 7, 0, 2, 2, 0, 15, 2, 0, 3, 3, 3, 56, 1, 1,
+	0, 1, 3, 7, 2, 3, 3, -1, 15, 2, 1, 2, 4, 4, 73, 2,
+	1, 1, 1, 2, 7, 2, 4, 4, -1, 0, 5, 7, 1, 6, 5, 2,
+	7, 0, 7, 6, 1, 7, 1, 8, 7, -1, 14
+};
+
+static lval *
+lispyc_consts1(void) {
+	return lispyc_list(lval_qexpr(), 9, lval_sym("*"), lval_sym("*"), lval_sym("+"), lval_sym("*"), lval_sym("*"), lval_num(1L), lval_sym("-"), lval_sym("+"), lval_sym("-"));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("deep")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 4, lval_sym("a"), lval_sym("b"), lval_sym("c"), lval_sym("d")), lispyc_list(lval_qexpr(), 3, lval_sym("-"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("c"), lval_sym("d"))), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("d")), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("b"), lval_sym("c")), lval_num(1L))))));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 5, lval_sym("deep"), lval_num(2L), lval_num(3L), lval_num(4L), lval_num(5L)));
+}
+
+// mixed
+static int
+lispyc_fn2(long *l, long *out) {
+	long s0;
+	long s1;
+	long s2;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	if (__builtin_mul_overflow(l[-0], l[-1], &s0)) { goto bail; }
+	goto L17;
+L17:
+	if (__builtin_mul_overflow(l[-0], l[-0], &s1)) { goto bail; }
+	goto L34;
+L34:
+	if (__builtin_add_overflow(l[-1], 0L, &s2)) { goto bail; }
+	goto L51;
+L51:
+	s1 = s1 < s2;
+	if (!s1) { goto L63; }
+	s1 = 1L;
+	goto L80;
+L63:
+	if (__builtin_mul_overflow(l[-1], l[-1], &s1)) { goto bail; }
+	goto L80;
+L80:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code2[] = {
+	15, 2, 0, 1, 0, 0, 17, 0, 1, 0, 1, 1, 7, 2, 0, 0,
+	-1, 15, 2, 0, 0, 1, 1, 34, 1, 1, 0, 1, 0, 7, 2, 1,
+	1, -1, 16, 0, 1, 2, 3, 2, 51, 2, 1, 1, 0, 2, 7, 0,
+	3, 2, -1, 7, 6, 4, 3, 1, 11, 63, 80, 0, 5, 12, 80, 15,
+	2, 1, 1, 6, 4, 80, -1, 1, 1, 1, 1, 7, 2, 6, 4, -1,
+	7, 0, 7, 5, -1, 14
+};
+
+static lval *
+lispyc_consts2(void) {
+	return lispyc_list(lval_qexpr(), 8, lval_sym("*"), lval_sym("*"), lval_num(0L), lval_sym("+"), lval_sym("<"), lval_num(1L), lval_sym("*"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form4(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("mixed")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("a")), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("b"), lval_num(0L))), lispyc_list(lval_qexpr(), 1, lval_num(1L)), lispyc_list(lval_qexpr(), 1, lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("b"), lval_sym("b")))))));
+}
+
+static lval *
+lispyc_form5(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("mixed"), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 3, lval_sym("mixed"), lval_num(3L), lval_num(2L)));
+}
+
+static lval *
+lispyc_form6(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("callin")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 2, lval_sym("head"), lispyc_list(lval_sexpr(), 3, lval_sym("list"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("b"), lval_num(3L))), lval_num(0L))))));
+}
+
+static lval *
+lispyc_form7(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("callin"), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form8(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("flt")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_fnum(0x1.8p+0), lval_sym("b")))));
+}
+
+static lval *
+lispyc_form9(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("flt"), lval_num(2L), lval_num(3L)));
+}
+
+// ovf
+static int
+lispyc_fn3(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	if (__builtin_mul_overflow(l[-0], l[-1], &s0)) { goto bail; }
+	goto L17;
+L17:
+	if (__builtin_mul_overflow(l[-0], l[-1], &s1)) { goto bail; }
+	goto L34;
+L34:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code3[] = {
+	15, 2, 0, 1, 0, 0, 17, 0, 1, 0, 1, 1, 7, 2, 0, 0,
+	-1, 15, 2, 0, 1, 1, 1, 34, 1, 1, 0, 1, 1, 7, 2, 1,
+	1, -1, 7, 0, 2, 2, -1, 14
+};
+
+static lval *
+lispyc_consts3(void) {
+	return lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("*"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form10(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("ovf")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")))));
+}
+
+static lval *
+lispyc_form11(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("ovf"), lval_num(4611686018427387904L), lval_num(1L)));
+}
+
+static lval *
+lispyc_form12(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("cmpz")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("a"), lval_sym("b"))), lispyc_list(lval_qexpr(), 1, lval_str("eq")), lispyc_list(lval_qexpr(), 1, lval_str("ne")))));
+}
+
+static lval *
+lispyc_form13(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("cmpz"), lval_num(2L), lval_num(2L)), lispyc_list(lval_sexpr(), 3, lval_sym("cmpz"), lval_num(2L), lval_num(3L)));
+}
+
+static lval *
+lispyc_form14(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("keep")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("list"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("b"), lval_sym("a"))), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")))));
+}
+
+static lval *
+lispyc_form15(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("keep"), lval_num(3L), lval_num(4L)));
+}
+
+// err
+static int
+lispyc_fn4(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	if (__builtin_mul_overflow(l[-0], l[-1], &s0)) { goto bail; }
+	goto L17;
+L17:
+	if (l[-1] == 0 || l[-1] == -1) { goto bail; }
+	s1 = l[-0] / l[-1];
+	goto L34;
+L34:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code4[] = {
+	15, 2, 0, 1, 0, 0, 17, 0, 1, 0, 1, 1, 7, 2, 0, 0,
+	-1, 15, 3, 0, 1, 1, 1, 34, 1, 1, 0, 1, 1, 7, 3, 1,
+	1, -1, 7, 0, 2, 2, -1, 14
+};
+
+static lval *
+lispyc_consts4(void) {
+	return lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("/"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form16(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("err")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("a"), lval_sym("b")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("b")), lispyc_list(lval_sexpr(), 3, lval_sym("/"), lval_sym("a"), lval_sym("b")))));
+}
+
+static lval *
+lispyc_form17(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("err"), lval_num(3L), lval_num(0L)));
+}
+
+static lval *
+lispyc_form18(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("grab")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("&"), lval_sym("xs")), lispyc_list(lval_qexpr(), 1, lval_sym("xs"))));
+}
+
+static lval *
+lispyc_form19(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_num(2L), lval_num(3L)), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_num(4L), lval_num(5L))));
+}
+
+// rec
+static int
+lispyc_fn5(long *l, long *out) {
+	long s0;
+	long s1;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	t = l[-0] == 0L;
+	if (t) { goto L20; }
+	goto L24;
+L20:
+	s0 = 0L;
+	goto L67;
+L24:
+	if (__builtin_mul_overflow(l[-0], l[-0], &s0)) { goto bail; }
+	goto L41;
+L41:
+	if (__builtin_sub_overflow(l[-0], 1L, &s1)) { goto bail; }
+	goto L58;
+L58:
+	{
+		long a[1] = { s1 };
+		if (!lispyc_fn5(&a[0], &s1)) { goto bail; }
+	}
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+L67:
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code5[] = {
+	18, 9, 0, 0, 1, 0, 20, 24, 1, 0, 0, 0, 7, 9, 1, 0,
+	-1, 11, 24, 67, 0, 2, 12, 67, 15, 2, 0, 0, 3, 1, 41, 0,
+	1, 0, 1, 0, 7, 2, 3, 1, -1, 16, 1, 0, 4, 5, 2, 58,
+	-1, 1, 0, 0, 4, 7, 1, 5, 2, -1, 5, 6, 3, 1, 7, 0,
+	7, 4, -1, 14
+};
+
+static lval *
+lispyc_consts5(void) {
+	return lispyc_list(lval_qexpr(), 8, lval_num(0L), lval_sym("=="), lval_num(0L), lval_sym("*"), lval_num(1L), lval_sym("-"), lval_sym("rec"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form20(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("rec")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 1, lval_sym("n")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_num(0L)), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("n"), lval_sym("n")), lispyc_list(lval_sexpr(), 2, lval_sym("rec"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)))))));
+}
+
+static lval *
+lispyc_form21(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 2, lval_sym("rec"), lval_num(50L)));
+}
+
+static lval *
+lispyc_form22(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("+")), lval_sym("grab"));
+}
+
+static lval *
+lispyc_form23(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 5, lval_sym("poly"), lval_num(2L), lval_num(3L), lval_num(4L), lval_num(5L)));
+}
+
+static lval *
+lispyc_form24(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 5, lval_sym("deep"), lval_num(2L), lval_num(3L), lval_num(4L), lval_num(5L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "poly", lispyc_code0, 40, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "deep", lispyc_code1, 91, lispyc_consts1(), lispyc_fn1);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form4());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "mixed", lispyc_code2, 86, lispyc_consts2(), lispyc_fn2);
+
+	x = lvm_eval(e, lispyc_form5());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form6());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form7());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form8());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form9());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form10());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "ovf", lispyc_code3, 40, lispyc_consts3(), lispyc_fn3);
+
+	x = lvm_eval(e, lispyc_form11());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form12());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form13());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form14());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form15());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form16());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "err", lispyc_code4, 40, lispyc_consts4(), lispyc_fn4);
+
+	x = lvm_eval(e, lispyc_form17());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form18());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form19());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form20());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "rec", lispyc_code5, 68, lispyc_consts5(), lispyc_fn5);
+
+	x = lvm_eval(e, lispyc_form21());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form22());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form23());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form24());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
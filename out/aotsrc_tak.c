@@ -0,0 +1,120 @@
+// generated by lispyc from "/tmp/aotsrc_tak.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+// tak
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	long s2;
+	long s3;
+	long s4;
+	long t;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+body:
+	t = l[-1] < l[-0];
+	if (t) { goto L20; }
+	goto L101;
+L20:
+	if (__builtin_sub_overflow(l[-0], 1L, &s0)) { goto bail; }
+	goto L37;
+L37:
+	s1 = l[-1];
+	s2 = l[-2];
+	{
+		long a[3] = { s2, s1, s0 };
+		if (!lispyc_fn0(&a[2], &s0)) { goto bail; }
+	}
+	if (__builtin_sub_overflow(l[-1], 1L, &s1)) { goto bail; }
+	goto L62;
+L62:
+	s2 = l[-2];
+	s3 = l[-0];
+	{
+		long a[3] = { s3, s2, s1 };
+		if (!lispyc_fn0(&a[2], &s1)) { goto bail; }
+	}
+	if (__builtin_sub_overflow(l[-2], 1L, &s2)) { goto bail; }
+	goto L87;
+L87:
+	s3 = l[-0];
+	s4 = l[-1];
+	{
+		long a[3] = { s4, s3, s2 };
+		if (!lispyc_fn0(&a[2], &s2)) { goto bail; }
+	}
+	l[-0] = s0;
+	l[-1] = s1;
+	l[-2] = s2;
+	goto body;
+L101:
+	s0 = l[-2];
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	17, 6, 1, 0, 0, 0, 20, 101, 1, 1, 1, 0, 7, 6, 0, 0,
+	-1, 11, 101, 103, 16, 1, 0, 1, 2, 1, 37, -1, 1, 0, 0, 1,
+	7, 1, 2, 1, -1, 1, 1, 1, 2, 5, 3, 2, 3, 16, 1, 1,
+	4, 5, 3, 62, -1, 1, 1, 0, 4, 7, 1, 5, 3, -1, 1, 2,
+	1, 0, 5, 6, 4, 3, 16, 1, 2, 7, 8, 5, 87, -1, 1, 2,
+	0, 7, 7, 1, 8, 5, -1, 1, 0, 1, 1, 5, 9, 6, 3, 6,
+	10, 7, 3, 12, 103, 1, 2, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 11, lval_sym("<"), lval_num(1L), lval_sym("-"), lval_sym("tak"), lval_num(1L), lval_sym("-"), lval_sym("tak"), lval_num(1L), lval_sym("-"), lval_sym("tak"), lval_sym("tak"));
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("tak")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("x"), lval_sym("y"), lval_sym("z")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("<"), lval_sym("y"), lval_sym("x")), lispyc_list(lval_qexpr(), 4, lval_sym("tak"), lispyc_list(lval_sexpr(), 4, lval_sym("tak"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("x"), lval_num(1L)), lval_sym("y"), lval_sym("z")), lispyc_list(lval_sexpr(), 4, lval_sym("tak"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("y"), lval_num(1L)), lval_sym("z"), lval_sym("x")), lispyc_list(lval_sexpr(), 4, lval_sym("tak"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("z"), lval_num(1L)), lval_sym("x"), lval_sym("y"))), lispyc_list(lval_qexpr(), 1, lval_sym("z")))));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 4, lval_sym("tak"), lval_num(18L), lval_num(12L), lval_num(6L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "tak", lispyc_code0, 104, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
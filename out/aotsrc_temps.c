@@ -0,0 +1,138 @@
+// generated by lispyc from "/tmp/aotsrc_temps.lspy"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+static lval *
+lispyc_list(lval *x, int n, ...) {
+	va_list ap;
+	va_start(ap, n);
+	for (int i = 0; i < n; i++) { lval_add(x, va_arg(ap, lval *)); }
+	va_end(ap);
+	return x;
+}
+
+// dist
+static int
+lispyc_fn0(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	if (__builtin_mul_overflow(l[-0], l[-0], &s0)) { goto bail; }
+	goto L17;
+L17:
+	if (__builtin_mul_overflow(l[-1], l[-1], &s1)) { goto bail; }
+	goto L34;
+L34:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	if (__builtin_mul_overflow(l[-2], l[-2], &s1)) { goto bail; }
+	goto L56;
+L56:
+	if (__builtin_add_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code0[] = {
+	15, 2, 0, 0, 0, 0, 17, 0, 1, 0, 1, 0, 7, 2, 0, 0,
+	-1, 15, 2, 1, 1, 1, 1, 34, 1, 1, 1, 1, 1, 7, 2, 1,
+	1, -1, 7, 0, 2, 2, 0, 15, 2, 2, 2, 3, 3, 56, 1, 1,
+	2, 1, 2, 7, 2, 3, 3, -1, 7, 0, 4, 4, -1, 14
+};
+
+static lval *
+lispyc_consts0(void) {
+	return lispyc_list(lval_qexpr(), 5, lval_sym("*"), lval_sym("*"), lval_sym("+"), lval_sym("*"), lval_sym("+"));
+}
+
+static lval *
+lispyc_form0(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("dist")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 3, lval_sym("x"), lval_sym("y"), lval_sym("z")), lispyc_list(lval_qexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("x"), lval_sym("x")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("y"), lval_sym("y"))), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("z"), lval_sym("z")))));
+}
+
+// det
+static int
+lispyc_fn1(long *l, long *out) {
+	long s0;
+	long s1;
+	if (ljit_depth >= LJIT_DEPTH) { return 0; }
+	ljit_depth++;
+	if (__builtin_mul_overflow(l[-0], l[-3], &s0)) { goto bail; }
+	goto L17;
+L17:
+	if (__builtin_mul_overflow(l[-1], l[-2], &s1)) { goto bail; }
+	goto L34;
+L34:
+	if (__builtin_sub_overflow(s0, s1, &s0)) { goto bail; }
+	*out = s0;
+	ljit_depth--;
+	return 1;
+bail:
+	ljit_depth--;
+	return 0;
+}
+
+static const int lispyc_code1[] = {
+	15, 2, 0, 3, 0, 0, 17, 0, 1, 0, 1, 3, 7, 2, 0, 0,
+	-1, 15, 2, 1, 2, 1, 1, 34, 1, 1, 1, 1, 2, 7, 2, 1,
+	1, -1, 7, 1, 2, 2, -1, 14
+};
+
+static lval *
+lispyc_consts1(void) {
+	return lispyc_list(lval_qexpr(), 3, lval_sym("*"), lval_sym("*"), lval_sym("-"));
+}
+
+static lval *
+lispyc_form1(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("det")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 4, lval_sym("a"), lval_sym("b"), lval_sym("c"), lval_sym("d")), lispyc_list(lval_qexpr(), 3, lval_sym("-"), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("a"), lval_sym("d")), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_sym("b"), lval_sym("c")))));
+}
+
+static lval *
+lispyc_form2(void) {
+	return lispyc_list(lval_sexpr(), 3, lval_sym("def"), lispyc_list(lval_qexpr(), 1, lval_sym("loop")), lispyc_list(lval_sexpr(), 3, lval_sym("\134"), lispyc_list(lval_qexpr(), 2, lval_sym("n"), lval_sym("acc")), lispyc_list(lval_qexpr(), 4, lval_sym("if"), lispyc_list(lval_sexpr(), 3, lval_sym("=="), lval_sym("n"), lval_num(0L)), lispyc_list(lval_qexpr(), 1, lval_sym("acc")), lispyc_list(lval_qexpr(), 3, lval_sym("loop"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("acc"), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lispyc_list(lval_sexpr(), 4, lval_sym("dist"), lval_sym("n"), lispyc_list(lval_sexpr(), 3, lval_sym("+"), lval_sym("n"), lval_num(1L)), lispyc_list(lval_sexpr(), 3, lval_sym("-"), lval_sym("n"), lval_num(2L))), lispyc_list(lval_sexpr(), 5, lval_sym("det"), lval_sym("n"), lval_num(3L), lispyc_list(lval_sexpr(), 3, lval_sym("*"), lval_num(2L), lval_sym("n")), lval_num(5L))))))));
+}
+
+static lval *
+lispyc_form3(void) {
+	return lispyc_list(lval_sexpr(), 2, lval_sym("print"), lispyc_list(lval_sexpr(), 3, lval_sym("loop"), lval_num(300000L), lval_num(0L)));
+}
+
+int
+main(void) {
+	lenv *e = lenv_new();
+	lenv_add_builtins(e);
+	lval *x;
+
+	x = lvm_eval(e, lispyc_form0());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "dist", lispyc_code0, 62, lispyc_consts0(), lispyc_fn0);
+
+	x = lvm_eval(e, lispyc_form1());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+	ljit_adopt(e, "det", lispyc_code1, 40, lispyc_consts1(), lispyc_fn1);
+
+	x = lvm_eval(e, lispyc_form2());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	x = lvm_eval(e, lispyc_form3());
+	if (x->type == LVAL_ERR) { lval_print(x); }
+	lval_del(x);
+
+	lenv_del(e);
+	return 0;
+}
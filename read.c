@@ -0,0 +1,547 @@
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+
+/*
+ * The reader: source text straight to values in a single pass, with no
+ * tree in between. It accepts what the mpc grammar in lparse_init does,
+ * token for token, and more besides in numbers:
+ *
+ *   number  : an optional '-', then 0x and hex digits, 0b and binary
+ *             digits, or decimal digits with optionally '.' and digits
+ *             and an exponent, 'e' and maybe a sign and digits; any
+ *             two digits may have a '_' between them
+ *   symbol  : letters, digits and any of  _ + - * / % \ = < > ! &
+ *   string  : '"' up to the next '"' not escaped by a backslash,
+ *             unescaped as mpcf_unescape does
+ *   comment : ';' up to the end of the line
+ *
+ * with whitespace between tokens, and numbers tried before symbols, so
+ * "12abc" reads as 12 followed by abc, and "1e" as 1 followed by e. With
+ * an exponent or a fraction a number is a float. Integers past 64 bits, and
+ * floats past the largest double or below the least subnormal, read as
+ * "invalid number" errors. Symbols are interned from the text itself; only
+ * strings and floats need a copy of their characters.
+ *
+ * Files are usually read straight from a mapping of them. A reader opened
+ * on a stream instead holds only a window of it: before each form the
+ * buffer is refilled until the whole form is in it, so it need only be as
+ * large as the largest form.
+ */
+
+static const char lread_symbol_chars[] =
+	"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_+-*/%\\=<>!&";
+
+// characters that may appear in a symbol, indexed by byte
+static char lread_symbol[256];
+
+static int
+lread_is_symbol(unsigned char ch) {
+	if (!lread_symbol['a']) {
+		for (const char *s = lread_symbol_chars; *s; s++) {
+			lread_symbol[(unsigned char) *s] = 1;
+		}
+	}
+	return lread_symbol[ch];
+}
+
+static int
+lread_is_digit(const char *p, const char *end) {
+	return p < end && *p >= '0' && *p <= '9';
+}
+
+void
+lreader_init(lreader *r, const char *name, const char *src, size_t len) {
+	r->name = name;
+	r->at = src;
+	r->end = src + len;
+	r->line = 1;
+	r->bol = src;
+	r->col = 0;
+	r->failed = 0;
+	r->in = NULL;
+	r->buf = NULL;
+	r->cap = 0;
+}
+
+// a reader of the stream in, which the caller closes after lreader_close
+void
+lreader_open(lreader *r, const char *name, FILE *in) {
+	lreader_init(r, name, "", 0);
+	r->cap = 64 * 1024;
+	r->buf = malloc(r->cap);
+	r->at = r->end = r->bol = r->buf;
+	r->in = in;
+}
+
+void
+lreader_close(lreader *r) {
+	free(r->buf);
+	r->buf = NULL;
+}
+
+static int
+lread_is_space(char ch) {
+	return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\f' || ch == '\v' || ch == '\n';
+}
+
+// whether the text from p holds a whole top-level form, so that reading
+// it never runs into the end of the buffer; an atom needs the character
+// after it too, as the next buffer could carry on with it
+static int
+lread_complete(const char *p, const char *end) {
+	int depth = 0;
+	while (p < end) {
+		char ch = *p++;
+		if (ch == ';') {
+			while (p < end && *p != '\n' && *p != '\r') { p++; }
+			if (p == end) { return 0; }
+		} else if (ch == '"') {
+			while (p < end && *p != '"') { p += *p == '\\' ? 2 : 1; }
+			if (p >= end) { return 0; }
+			p++;
+			if (!depth) { return 1; }
+		} else if (ch == '(' || ch == '{') {
+			depth++;
+		} else if (ch == ')' || ch == '}') {
+			// at the top, a stray bracket the reader reports
+			if (--depth <= 0) { return 1; }
+		} else if (!depth && !lread_is_space(ch)) {
+			while (p < end && !lread_is_space(*p) && !strchr("(){}\";", *p)) { p++; }
+			return p < end;
+		}
+	}
+	return 0;
+}
+
+// refills the buffer of a stream reader until it holds the next form, or
+// the rest of the stream; in is cleared once that has all been read
+static void
+lread_fill(lreader *r) {
+	while (r->in && !lread_complete(r->at, r->end)) {
+		size_t keep = r->end - r->at;
+		r->col += r->at - r->bol;
+		memmove(r->buf, r->at, keep);
+		if (keep == r->cap) { r->buf = realloc(r->buf, r->cap *= 2); }
+		size_t n = fread(r->buf + keep, 1, r->cap - keep, r->in);
+		r->at = r->bol = r->buf;
+		r->end = r->buf + keep + n;
+		if (n == 0) { r->in = NULL; }
+	}
+}
+
+static void
+lread_newline(lreader *r) {
+	r->line++;
+	r->bol = r->at;
+	r->col = 0;
+}
+
+// an error at the reader's position, in the form mpc reports them
+static lval *
+lread_error(lreader *r, const char *expected) {
+	int col = (int) (r->col + (r->at - r->bol)) + 1;
+	if (r->at >= r->end) {
+		return lval_err("%s:%i:%i: error: expected %s at end of input\n",
+			r->name, r->line, col, expected);
+	}
+	return lval_err("%s:%i:%i: error: expected %s at '%c'\n",
+		r->name, r->line, col, expected, *r->at);
+}
+
+// skips whitespace and comments
+static void
+lread_space(lreader *r) {
+	while (r->at < r->end) {
+		char ch = *r->at;
+		if (ch == '\n') {
+			r->at++;
+			lread_newline(r);
+		} else if (lread_is_space(ch)) {
+			r->at++;
+		} else if (ch == ';') {
+			while (r->at < r->end && *r->at != '\n' && *r->at != '\r') { r->at++; }
+		} else {
+			return;
+		}
+	}
+}
+
+/*
+ * Numbers. Decimal digits are gathered into a 64-bit mantissa, eight at a
+ * time where the source has that many in a row; floats whose mantissa and
+ * power of ten are both exact as doubles are then a single correctly
+ * rounded multiply or divide, and the rest go to strtod.
+ */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define LREAD_SWAR
+#endif
+
+// the value of ch as a digit in base, or -1
+static int
+lread_digit(char ch, int base) {
+	int d = ch >= '0' && ch <= '9' ? ch - '0' :
+		(ch | 0x20) >= 'a' && (ch | 0x20) <= 'f' ? (ch | 0x20) - 'a' + 10 : -1;
+	return d < base ? d : -1;
+}
+
+// the end of the digit at p, past a '_' before it if there is one
+static const char *
+lread_next_digit(const char *p, const char *end, int base) {
+	if (p < end && *p == '_') { p++; }
+	return p < end && lread_digit(*p, base) >= 0 ? p : NULL;
+}
+
+typedef struct lread_mantissa {
+	// up to 19 significant digits, which always fit
+	uint64_t m;
+	int digits;
+	// digits added to m, and those past the 19 it holds, some nonzero if
+	// inexact is set
+	int taken;
+	int dropped;
+	int inexact;
+} lread_mantissa;
+
+#ifdef LREAD_SWAR
+// whether the eight bytes of v are all decimal digits
+static int
+lread_eight_digits(uint64_t v) {
+	return ((v & 0xF0F0F0F0F0F0F0F0) |
+		(((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
+
+// the value of eight decimal digits, the first in the lowest byte
+static uint32_t
+lread_eight_value(uint64_t v) {
+	v -= 0x3030303030303030;
+	v = v * 10 + (v >> 8);
+	v = ((v & 0x000000FF000000FF) * (100 + (1000000ULL << 32)) +
+		((v >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32))) >> 32;
+	return (uint32_t) v;
+}
+
+// adds the eight digits at p to x, if they are digits and all count
+static int
+lread_eight(const char *p, const char *end, lread_mantissa *x) {
+	uint64_t v;
+	if (end - p < 8 || x->digits > 11 || (!x->m && *p == '0')) { return 0; }
+	memcpy(&v, p, 8);
+	if (!lread_eight_digits(v)) { return 0; }
+	x->m = x->m * 100000000 + lread_eight_value(v);
+	x->digits += 8;
+	x->taken += 8;
+	return 1;
+}
+#else
+static int
+lread_eight(const char *p, const char *end, lread_mantissa *x) {
+	return 0;
+}
+#endif
+
+// adds the decimal digits from p, which starts with one, to x, and
+// returns the end of them
+static const char *
+lread_decimal(const char *p, const char *end, lread_mantissa *x) {
+	// once fewer than eight are left there is no use looking for eight
+	int eight = 1;
+	for (;;) {
+		if (eight && (eight = lread_eight(p, end, x))) {
+			p += 8;
+		} else {
+			int d = *p++ - '0';
+			if (x->digits < 19) {
+				x->m = x->m * 10 + d;
+				x->digits += x->m != 0;
+				x->taken++;
+			} else {
+				x->dropped++;
+				x->inexact |= d != 0;
+			}
+		}
+		if (p < end && *p >= '0' && *p <= '9') { continue; }
+		if (end - p < 2 || *p != '_' || p[1] < '0' || p[1] > '9') { return p; }
+		p++;
+	}
+}
+
+// the integer in base from p, which starts with a digit, or 0 in range if
+// its magnitude is over limit
+static const char *
+lread_integer(const char *p, const char *end, int base, uint64_t limit,
+	uint64_t *n, int *range) {
+	const char *q = p;
+	*n = 0;
+	*range = 1;
+	do {
+		p = q;
+		int d = lread_digit(*p++, base);
+		if (*n > (limit - d) / base) { *range = 0; }
+		*n = *range ? *n * base + d : 0;
+	} while ((q = lread_next_digit(p, end, base)));
+	return p;
+}
+
+// the float the characters from start to end spell, less any '_'
+static lval *
+lread_strtod(const char *start, const char *end) {
+	size_t len = end - start;
+	char small[64];
+	char *s = len < sizeof(small) ? small : malloc(len + 1);
+	size_t n = 0;
+	for (const char *p = start; p < end; p++) {
+		if (*p != '_') { s[n++] = *p; }
+	}
+	s[n] = '\0';
+	errno = 0;
+	double x = strtod(s, NULL);
+	if (s != small) { free(s); }
+	// out of range only past the largest double, or below the least
+	// subnormal; a subnormal itself is read, though with fewer digits
+	return errno != ERANGE || (x != 0 && !isinf(x)) ? lval_fnum(x) :
+		lval_err("invalid number");
+}
+
+// the number at r, which lread_is_number accepted
+static lval *
+lread_number(lreader *r) {
+	static const double powers[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+	};
+
+	const char *start = r->at;
+	const char *end = r->end;
+	const char *p = start;
+	int neg = *p == '-';
+	p += neg;
+	// the magnitude of LONG_MIN is one more than LONG_MAX
+	uint64_t limit = (uint64_t) LONG_MAX + neg;
+
+	int base = 10;
+	if (p[0] == '0' && end - p > 2 && lread_digit(p[2], 16) >= 0 &&
+		((p[1] | 0x20) == 'x' || ((p[1] | 0x20) == 'b' && lread_digit(p[2], 2) >= 0))) {
+		base = (p[1] | 0x20) == 'x' ? 16 : 2;
+		p += 2;
+	}
+	if (base != 10) {
+		uint64_t n;
+		int range;
+		r->at = lread_integer(p, end, base, limit, &n, &range);
+		if (!range) { return lval_err("invalid number"); }
+		return lval_num(neg ? (n == limit ? LONG_MIN : -(long) n) : (long) n);
+	}
+
+	lread_mantissa x = {0, 0, 0, 0, 0};
+	p = lread_decimal(p, end, &x);
+	int exp10 = x.dropped;
+	int fnum = 0;
+
+	if (end - p > 1 && *p == '.' && lread_digit(p[1], 10) >= 0) {
+		fnum = 1;
+		int taken = x.taken;
+		p = lread_decimal(p + 1, end, &x);
+		exp10 -= x.taken - taken;
+	}
+
+	if (p < end && (*p | 0x20) == 'e') {
+		const char *q = p + 1;
+		int eneg = q < end && *q == '-';
+		q += q < end && (*q == '-' || *q == '+');
+		if (q < end && lread_digit(*q, 10) >= 0) {
+			fnum = 1;
+			uint64_t e;
+			int range;
+			p = lread_integer(q, end, 10, 100000, &e, &range);
+			// far past any double, and kept from overflowing exp10
+			if (!range) { e = 100000; }
+			exp10 += eneg ? -(int) e : (int) e;
+		}
+	}
+	r->at = p;
+
+	if (!fnum) {
+		if (x.dropped || x.m > limit) { return lval_err("invalid number"); }
+		return lval_num(neg ? (x.m == limit ? LONG_MIN : -(long) x.m) : (long) x.m);
+	}
+
+	// both exact, so one rounding gives the nearest double
+	if (!x.inexact && x.m <= (uint64_t) 1 << 53 && exp10 >= -22 && exp10 <= 22) {
+		double f = (double) x.m;
+		f = exp10 < 0 ? f / powers[-exp10] : f * powers[exp10];
+		return lval_fnum(neg ? -f : f);
+	}
+	return lread_strtod(start, p);
+}
+
+static int
+lread_is_number(lreader *r) {
+	const char *p = r->at;
+	if (p < r->end && *p == '-') { p++; }
+	return lread_is_digit(p, r->end);
+}
+
+// the string at r, unescaping the pairs mpcf_unescape knows
+static lval *
+lread_string(lreader *r) {
+	static const char escapes[] = "abfnrtv\\'\"0";
+	static const char chars[] = "\a\b\f\n\r\t\v\\'\"";
+
+	const char *start = r->at++;
+
+	// most strings have no escapes or line breaks, and are copied
+	// straight from the source
+	const char *p = r->at;
+	while (p < r->end && *p != '"' && *p != '\\' && *p != '\n') { p++; }
+	if (p < r->end && *p == '"') {
+		lval *v = lval_strn(r->at, p - r->at);
+		r->at = p + 1;
+		return v;
+	}
+
+	int line = r->line;
+	const char *bol = r->bol;
+	long col = r->col;
+	size_t cap = 64, len = 0;
+	char *s = malloc(cap);
+	while (r->at < r->end && *r->at != '"') {
+		if (len + 2 >= cap) {
+			cap *= 2;
+			s = realloc(s, cap);
+		}
+		char ch = *r->at++;
+		if (ch == '\\' && r->at < r->end) {
+			ch = *r->at++;
+			const char *e = ch ? strchr(escapes, ch) : NULL;
+			if (ch == '\n') { lread_newline(r); }
+			if (!e) {
+				s[len++] = '\\';
+			} else if (ch == '0') {
+				// mpc drops escaped NULs
+				continue;
+			} else {
+				ch = chars[e - escapes];
+			}
+		} else if (ch == '\n') {
+			lread_newline(r);
+		}
+		s[len++] = ch;
+	}
+	if (r->at >= r->end) {
+		free(s);
+		r->at = start;
+		r->line = line;
+		r->bol = bol;
+		r->col = col;
+		r->failed = 1;
+		return lread_error(r, "a string ending in '\"'");
+	}
+	r->at++;
+	s[len] = '\0';
+	lval *v = lval_str(s);
+	free(s);
+	return v;
+}
+
+// a number, symbol or string at r, which is not at the end
+static lval *
+lread_atom(lreader *r, const char *expected) {
+	unsigned char ch = *r->at;
+	if (lread_is_number(r)) { return lread_number(r); }
+	if (lread_is_symbol(ch)) {
+		const char *start = r->at;
+		while (r->at < r->end && lread_is_symbol(*r->at)) { r->at++; }
+		return lval_symn(start, r->at - start);
+	}
+	if (ch == '"') { return lread_string(r); }
+	r->failed = 1;
+	return lread_error(r, expected);
+}
+
+// the expression at r, which is not at the end; a syntax error sets
+// r->failed, unlike numbers out of range, which read as error values.
+// The lists still open are kept on a stack here rather than on the C
+// stack, so nesting is bounded only by memory
+static lval *
+lread_expr(lreader *r, const char *expected) {
+	lval **open = NULL;
+	int depth = 0, cap = 0;
+	for (;;) {
+		lval *v = NULL;
+		if (*r->at == '(' || *r->at == '{') {
+			if (depth == cap) {
+				cap = cap ? cap * 2 : 16;
+				open = realloc(open, sizeof(lval *) * cap);
+			}
+			open[depth++] = *r->at == '(' ? lval_sexpr() : lval_qexpr();
+			r->at++;
+		} else {
+			v = lread_atom(r, expected);
+		}
+		// hand v to the list it is in, and close every list that ends
+		// after it, until one needs another expression
+		for (;;) {
+			if (v && (r->failed || !depth)) {
+				while (depth) { lval_del(open[--depth]); }
+				free(open);
+				return v;
+			}
+			if (v) { lval_add(open[depth - 1], v); }
+			char close = open[depth - 1]->type == LVAL_SEXPR ? ')' : '}';
+			lread_space(r);
+			if (r->at < r->end && *r->at == close) {
+				r->at++;
+				v = open[--depth];
+				continue;
+			}
+			expected = close == ')' ? "an expression or ')'" :
+				"an expression or '}'";
+			if (r->at >= r->end || *r->at == ')' || *r->at == '}') {
+				r->failed = 1;
+				v = lread_error(r, expected);
+				continue;
+			}
+			break;
+		}
+	}
+}
+
+// the next top-level form, NULL once there are none, or a syntax error
+lval *
+lread_next(lreader *r) {
+	if (r->failed) { return NULL; }
+	lread_fill(r);
+	lread_space(r);
+	if (r->at >= r->end) { return NULL; }
+	if (*r->at == ')' || *r->at == '}') {
+		r->failed = 1;
+		return lread_error(r, "an expression or end of input");
+	}
+	return lread_expr(r, "an expression or end of input");
+}
+
+// all the forms in the len characters at src, or the first syntax error
+lval *
+lread_all(const char *name, const char *src, size_t len) {
+	lreader r;
+	lreader_init(&r, name, src, len);
+	lval *forms = lval_sexpr();
+	lval *v;
+	while ((v = lread_next(&r))) {
+		if (r.failed) {
+			lval_del(forms);
+			return v;
+		}
+		lval_add(forms, v);
+	}
+	return forms;
+}
@@ -0,0 +1,47 @@
+# 'autoload' loads a file the first time a symbol it provides is looked
+# up and nothing binds it, and loads each file only once
+cd "$(mktemp -d)" || exit 1
+trap 'rm -rf "$PWD"' EXIT
+
+cat > lib.lspy <<'LISPY'
+(print "lib loaded")
+(def {sq} (\ {x} {* x x}))
+(def {cube} (\ {x} {* x (sq x)}))
+LISPY
+cat > broken.lspy <<'LISPY'
+(print "broken loaded")
+(def {half} (\ {x} {/ x 2}))
+(
+LISPY
+cat > other.lspy <<'LISPY'
+(print "other loaded")
+(def {late} 2)
+LISPY
+cat > main.lspy <<'LISPY'
+(autoload "lib.lspy" {sq cube tri})
+(autoload "missing.lspy" {gone})
+(autoload "broken.lspy" {half})
+(print "registered")
+
+; the first use loads lib.lspy, and nothing uses it again
+(print (sq 3))
+(print (cube 2) (sq 4))
+
+; a symbol its file does not define stays unbound, without a second load
+(print tri)
+
+; a file that cannot be read, or stops at a syntax error, is reported,
+; keeping what it defined before the error
+gone
+(print (half 8))
+
+; a binding made first is used, so the file is never loaded
+(autoload "other.lspy" {late})
+(def {late} 1)
+(print late)
+
+(autoload "lib.lspy" {1})
+(autoload sq {sq})
+LISPY
+
+"$LISPY" --no-cache main.lspy
@@ -0,0 +1,38 @@
+# Loads read the .lspyc cache beside a source while its size and time
+# match, and read the source again, writing a new cache, once they do not
+cd "$(mktemp -d)" || exit 1
+trap 'rm -rf "$PWD"' EXIT
+
+printf '(print "first")\n(print (+ 1 2))\n' > m.lspy
+"$LISPY" m.lspy
+test -f m.lspyc && echo "cache written"
+"$LISPY" m.lspy
+
+# other text of the same size and time: only the cache is read
+touch -r m.lspy stamp
+printf '(print "other")\n(print (+ 1 3))\n' > m.lspy
+touch -r stamp m.lspy
+"$LISPY" m.lspy
+
+# the same text at another time, then edited text
+touch -d 2001-01-01 m.lspy
+"$LISPY" m.lspy
+printf '(print "edited")\n' > m.lspy
+"$LISPY" m.lspy
+"$LISPY" m.lspy
+
+# a cache cut short gives the forms it holds, and the source the rest
+printf '(print "a")\n(print "b")\n(print "c")\n' > m.lspy
+"$LISPY" m.lspy > /dev/null
+head -c $(($(wc -c < m.lspyc) - 4)) m.lspyc > cut
+mv cut m.lspyc
+"$LISPY" m.lspy
+"$LISPY" m.lspy
+
+# 'load' from a script uses the cache too, and --no-cache neither reads
+# nor writes one
+printf '(load "m.lspy")\n' > main.lspy
+"$LISPY" main.lspy
+rm m.lspyc
+"$LISPY" --no-cache main.lspy
+test -f m.lspyc || echo "no cache"
@@ -0,0 +1,27 @@
+# An image keeps the global bindings and the autoloads not yet used, and
+# leaves out those whose file was loaded before it was saved
+cd "$(mktemp -d)" || exit 1
+trap 'rm -rf "$PWD"' EXIT
+
+cat > lib.lspy <<'LISPY'
+(print "lib loaded")
+(def {sq} (\ {x} {* x x}))
+(def {cube} (\ {x} {* x (sq x)}))
+LISPY
+cat > other.lspy <<'LISPY'
+(print "other loaded")
+(def {inc} (\ {x} {+ x 1}))
+LISPY
+cat > index.lspy <<'LISPY'
+(def {two} 2)
+(autoload "lib.lspy" {sq cube})
+(autoload "other.lspy" {inc})
+(print (inc two))
+(save-image "s.img")
+LISPY
+cat > use.lspy <<'LISPY'
+(print (cube two) (sq 3) (inc 5))
+LISPY
+
+"$LISPY" --no-cache index.lspy
+"$LISPY" --no-cache --image s.img use.lspy < /dev/null
@@ -0,0 +1,16 @@
+# Lists nested far deeper than a reader recursing on the C stack could
+# go, read from a file, from a pipe and from the file's cache
+cd "$(mktemp -d)" || exit 1
+trap 'rm -rf "$PWD"' EXIT
+
+n=100000
+open=$(head -c $n /dev/zero | tr '\0' '{')
+close=$(head -c $n /dev/zero | tr '\0' '}')
+printf '(def {x} {%s1%s 2})\n(print (tail x))\n' "$open" "$close" > deep.lspy
+printf '(print 1)\n%s\n' "$open" > open.lspy
+
+"$LISPY" --no-cache deep.lspy
+"$LISPY" --no-cache /dev/stdin < deep.lspy
+"$LISPY" deep.lspy
+test -f deep.lspyc && "$LISPY" deep.lspy
+"$LISPY" --no-cache open.lspy
@@ -0,0 +1,13 @@
+# --max-depth takes a whole number from 1 to INT_MAX, and anything else
+# stops lispy with a message saying so
+cd "$(mktemp -d)" || exit 1
+trap 'rm -rf "$PWD"' EXIT
+
+printf '(def {f} (\\ {n} {if (== n 0) {0} {+ 1 (f (- n 1))}}))\n(print (f 50))\n' > deep.lspy
+
+for depth in 100 2147483647 10 0 -1 abc 10x '' 2147483648 99999999999; do
+	"$LISPY" --no-cache --max-depth "$depth" deep.lspy 2>&1
+	echo " ($depth: $?)"
+done
+"$LISPY" --max-depth 2>&1
+echo " (none: $?)"
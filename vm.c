@@ -0,0 +1,958 @@
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mpc/mpc.h"
+#include "lispy.h"
+#include "vm.h"
+
+typedef struct lframe lframe;
+
+struct lframe {
+	lframe *caller;
+	lchunk *chunk;
+	// lambda whose formals name the locals; differs from chunk once a
+	// tail 'eval' replaces the code running in this scope
+	lchunk *scope;
+	intptr_t *ip;
+	// stack index that receives the result on return
+	int ret;
+	// scope lookups start from: &locals for lambdas, the caller's otherwise
+	lenv *env;
+	lenv locals;
+	int cap;
+	lval **slots;
+	// table and arguments to record the result under, for calls to
+	// lambdas wrapped by 'memo'
+	lmemo *memo;
+	lval *key;
+	int nscratch;
+	lval *scratch;
+};
+
+lbuiltin arith_builtins[ARITH_COUNT] = {
+	builtin_add, builtin_sub, builtin_mul, builtin_div, builtin_mod,
+	builtin_gt, builtin_lt, builtin_ge, builtin_le, builtin_eq, builtin_ne
+};
+
+static lval **lvm_stack;
+static int lvm_sp;
+static int lvm_cap;
+
+// frames are recycled rather than freed so calls do not hit malloc
+static lframe *lvm_frames;
+
+/*
+ * Frames live on the heap, so calls the VM runs itself use no C stack
+ * and recursion is only bounded by lvm_max_depth, the number of frames
+ * in use. Entries into the evaluator from C, as in 'load' or applying a
+ * partially applied lambda, do nest on the C stack, and LVM_NESTING
+ * bounds them separately.
+ */
+int lvm_max_depth = LVM_MAX_DEPTH;
+int lvm_depth;
+int lvm_nesting;
+
+int lvm_stats;
+long lvm_temps;
+
+static void
+lvm_push(lval *v) {
+	if (lvm_sp == lvm_cap) {
+		lvm_cap = lvm_cap ? lvm_cap * 2 : 256;
+		lvm_stack = realloc(lvm_stack, sizeof(lval *) * lvm_cap);
+	}
+	lvm_stack[lvm_sp++] = v;
+}
+
+// grows f's scratch cells for c; only done with none of them in use
+static void
+lframe_scratch(lframe *f, lchunk *c) {
+	if (f->nscratch < c->nscratch) {
+		f->nscratch = c->nscratch;
+		f->scratch = realloc(f->scratch, sizeof(lval) * f->nscratch);
+	}
+}
+
+static lframe *
+lframe_new(lframe *caller, lchunk *c, lenv *e, int ret) {
+	lframe *f = lvm_frames;
+	if (f) {
+		lvm_frames = f->caller;
+	} else {
+		f = malloc(sizeof(*f));
+		f->cap = 0;
+		f->slots = NULL;
+		f->nscratch = 0;
+		f->scratch = NULL;
+	}
+	lvm_depth++;
+
+	f->caller = caller;
+	f->chunk = lchunk_retain(c);
+	f->ip = c->exec;
+	f->ret = ret;
+	f->memo = NULL;
+	lframe_scratch(f, c);
+
+	if (!c->lambda) {
+		f->scope = NULL;
+		f->env = e;
+		return f;
+	}
+
+	f->scope = lchunk_retain(c);
+
+	if (f->cap < c->nlocals) {
+		f->cap = c->nlocals;
+		f->slots = realloc(f->slots, sizeof(lval *) * f->cap);
+	}
+	f->locals.par = e;
+	f->locals.count = 0;
+	f->locals.borrowed = 1;
+	f->locals.syms = c->locals;
+	f->locals.vals = f->slots;
+	f->locals.vers = NULL;
+	f->env = &f->locals;
+	return f;
+}
+
+// moves argc arguments starting at lvm_stack[base] into the frame's locals
+static void
+lframe_bind(lframe *f, int base, int argc) {
+	lchunk *c = f->chunk;
+	for (int i = 0; i < c->nformals; i++) {
+		f->slots[i] = lvm_stack[base + i];
+	}
+	if (c->variadic) {
+		lval *rest = lval_qexpr();
+		for (int i = c->nformals; i < argc; i++) {
+			lval_add(rest, lvm_stack[base + i]);
+		}
+		f->slots[c->nformals] = rest;
+	}
+	f->locals.count = c->nlocals;
+}
+
+static void
+lframe_clear(lframe *f) {
+	for (int i = 0; i < f->locals.count; i++) {
+		lval_del(f->locals.vals[i]);
+	}
+	// '=' may have grown the scope into arrays of its own
+	if (!f->locals.borrowed) {
+		free(f->locals.syms);
+		free(f->locals.vals);
+		free(f->locals.vers);
+	}
+	lchunk_release(f->scope);
+}
+
+static lframe *
+lframe_leave(lframe *f) {
+	if (f->scope) { lframe_clear(f); }
+	lchunk_release(f->chunk);
+
+	lframe *caller = f->caller;
+	f->caller = lvm_frames;
+	lvm_frames = f;
+	lvm_depth--;
+	return caller;
+}
+
+/*
+ * Scopes above the global one are small, so they are scanned; but a chain
+ * of them grows with the recursion depth, and names no scope has ever
+ * bound, such as those of builtins and most globals, go straight to the
+ * global scope the cache found them in.
+ */
+static lenv *
+lvm_global(lenv *e, char *sym, lcache *c) {
+	if (!LSYM_LOCAL(sym) && c->env) { return c->env; }
+	while (e->par) { e = e->par; }
+	return e;
+}
+
+// borrowed reference to the value bound to sym, or NULL if unbound
+static lval *
+lvm_lookup(lenv *e, char *sym, lcache *c) {
+	if (LSYM_LOCAL(sym)) {
+		for (; e->par; e = e->par) {
+			for (int i = 0; i < e->count; i++) {
+				if (e->syms[i] == sym) { return e->vals[i]; }
+			}
+		}
+	}
+	e = lvm_global(e, sym, c);
+
+	// global slots never move, so a cached slot stays valid while it matches
+	if (c->env == e && c->slot < e->count && e->syms[c->slot] == sym) {
+		return e->vals[c->slot];
+	}
+	for (int i = 0; i < e->count; i++) {
+		if (e->syms[i] == sym) {
+			c->env = e;
+			c->slot = i;
+			return e->vals[i];
+		}
+	}
+	return lenv_autoload(e, sym) ? lvm_lookup(e, sym, c) : NULL;
+}
+
+// stamp of the global binding sym resolves to from e; 0 when a local
+// shadows it or it is unbound
+unsigned
+lvm_version(lenv *e, char *sym, lcache *c) {
+	if (LSYM_LOCAL(sym)) {
+		for (; e->par; e = e->par) {
+			for (int i = 0; i < e->count; i++) {
+				if (e->syms[i] == sym) { return 0; }
+			}
+		}
+	}
+	e = lvm_global(e, sym, c);
+	if (!lvm_lookup(e, sym, c) || !e->vers) { return 0; }
+	return e->vers[c->slot];
+}
+
+// packs the top argc stack entries into an argument list for a builtin
+static lval *
+lvm_collect(int base, int argc) {
+	lval *a = lval_sexpr();
+	if (argc) {
+		a->count = argc;
+		a->cells = malloc(sizeof(lval *) * argc);
+		memcpy(a->cells, &lvm_stack[base], sizeof(lval *) * argc);
+	}
+	lvm_sp = base;
+	return a;
+}
+
+/*
+ * Reuses a lambda frame for a tail call to callee. With dynamic scoping
+ * the callee can still look up whatever its formals leave visible of the
+ * caller's scope, so those bindings are carried over behind the formals.
+ */
+static void
+lframe_rebind(lframe *f, lchunk *callee, int base, int argc) {
+	int carry = 0;
+	for (int i = 0; i < f->locals.count && !carry; i++) {
+		carry = lchunk_local(callee, f->locals.syms[i]) < 0;
+	}
+
+	// the caller's bindings leave the slots the arguments go into
+	lenv caller = f->locals;
+	if (carry) {
+		lenv_own(&caller);
+		f->locals.count = 0;
+		f->locals.borrowed = 1;
+	}
+
+	lchunk_retain(callee);
+	lchunk_retain(callee);
+	lframe_clear(f);
+	lchunk_release(f->chunk);
+
+	f->chunk = callee;
+	f->scope = callee;
+	f->ip = callee->exec;
+	lframe_scratch(f, callee);
+	if (f->cap < callee->nlocals) {
+		f->cap = callee->nlocals;
+		f->slots = realloc(f->slots, sizeof(lval *) * f->cap);
+	}
+	f->locals.count = 0;
+	f->locals.borrowed = 1;
+	f->locals.syms = callee->locals;
+	f->locals.vals = f->slots;
+	f->locals.vers = NULL;
+	lframe_bind(f, base, argc);
+	if (!carry) { return; }
+
+	lenv_own(&f->locals);
+	lenv_carry(&f->locals, &caller);
+	for (int i = 0; i < caller.count; i++) {
+		lval_del(caller.vals[i]);
+	}
+	free(caller.syms);
+	free(caller.vals);
+	free(caller.vers);
+}
+
+// continues a frame with x, a tail 'eval' or 'if' branch, instead of its code
+static void
+lframe_switch(lframe *f, lval *x) {
+	lchunk *c = lcompile_expr(f->env, x);
+	lval_del(x);
+	lchunk_release(f->chunk);
+	f->chunk = c;
+	f->ip = c->exec;
+	lframe_scratch(f, c);
+}
+
+// counts an entry into the evaluator on the C stack, or returns 0 when
+// there is no room left for one
+int
+lvm_nest(void) {
+	if (lvm_nesting >= LVM_NESTING || lvm_depth + lvm_nesting >= lvm_max_depth) {
+		return 0;
+	}
+	lvm_nesting++;
+	return 1;
+}
+
+// records v as the result of a call to a lambda wrapped by 'memo'
+static void
+lframe_remember(lframe *f, lval *v) {
+	// errors such as exceeding the stack depth may not recur
+	if (v->type == LVAL_ERR) {
+		lval_del(f->key);
+	} else {
+		lmemo_put(f->memo, f->key, v);
+	}
+	lmemo_release(f->memo);
+	f->memo = NULL;
+}
+
+// whether v is one of f's scratch cells rather than on the heap
+#define LFRAME_TEMP(f, v) ((v) >= (f)->scratch && (v) < (f)->scratch + (f)->nscratch)
+
+// the result n of inline arithmetic, kept in scratch cell s unless s is -1
+static lval *
+lframe_number(lframe *f, int s, long n) {
+	if (s < 0) { return lval_num(n); }
+	lval *v = &f->scratch[s];
+	v->type = LVAL_NUM;
+	v->val.num = n;
+	v->count = 0;
+	v->cells = NULL;
+	lvm_temps++;
+	return v;
+}
+
+// moves the argc operands at lvm_stack[base] out of f's scratch cells
+static void
+lframe_detach(lframe *f, int base, int argc) {
+	for (int i = base; i < base + argc; i++) {
+		if (LFRAME_TEMP(f, lvm_stack[i])) {
+			lvm_stack[i] = lval_num(lvm_stack[i]->val.num);
+		}
+	}
+}
+
+// leaves the error a call gets instead of a frame once all are in use
+static int
+lvm_overflow(int ret) {
+	if (lvm_depth < lvm_max_depth) { return 0; }
+	lvm_sp = ret;
+	lvm_push(lval_err("stack depth exceeded"));
+	return 1;
+}
+
+int
+lvm_accepts(lenv *e, lval *f, int argc) {
+	if (f->type != LVAL_LAMBDA) { return 0; }
+
+	// partially applied lambdas keep their bindings in an environment
+	lcontext *ctx = f->val.context;
+	if (ctx->env->count) { return 0; }
+
+	if (!ctx->chunk) {
+		ctx->chunk = lcompile_lambda(e, ctx->formals, ctx->body);
+		if (!ctx->chunk) { return 0; }
+	}
+	if (ctx->chunk->variadic) { return argc >= ctx->chunk->nformals; }
+	return argc == ctx->chunk->nformals;
+}
+
+/*
+ * Applies f to the argc values at lvm_stack[base], leaving the result at
+ * lvm_stack[ret]. Lambdas the VM can run get a frame, which is returned
+ * for the caller to switch to; everything else completes here. In tail
+ * position the current frame is reused where possible.
+ */
+static lframe *
+lvm_apply(lframe *frame, lval *f, int owned, int base, int argc, int ret,
+	int tail) {
+	lval *r;
+
+	// the first erroneous argument becomes the result
+	for (int i = 0; i < argc; i++) {
+		if (lvm_stack[base + i]->type == LVAL_ERR) {
+			r = lval_take(lvm_collect(base, argc), i);
+			if (owned) { lval_del(f); }
+			lvm_sp = ret;
+			lvm_push(r);
+			return NULL;
+		}
+	}
+
+	switch (f->type) {
+		case LVAL_FUN: {
+			lval *a = lvm_collect(base, argc);
+			lval *x = lval_tail(f, a);
+			lbuiltin fn = f->val.builtin;
+			if (owned) { lval_del(f); }
+			lvm_sp = ret;
+			if (x && tail) {
+				lframe_switch(frame, x);
+				return frame;
+			}
+			// elsewhere the expression gets a frame in the caller's scope
+			if (x) {
+				if (lvm_overflow(ret)) {
+					lval_del(x);
+					return NULL;
+				}
+				lchunk *c = lcompile_expr(frame->env, x);
+				lval_del(x);
+				lframe *next = lframe_new(frame, c, frame->env, ret);
+				lchunk_release(c);
+				return next;
+			}
+			lvm_push(fn(frame->env, a));
+			return NULL;
+		}
+		case LVAL_LAMBDA: {
+			lmemo *memo = f->val.context->memo;
+			if (memo && (r = lmemo_get(memo, &lvm_stack[base], argc))) {
+				r = lval_copy(r);
+				lval_del(lvm_collect(base, argc));
+				if (owned) { lval_del(f); }
+				lvm_sp = ret;
+				lvm_push(r);
+				return NULL;
+			}
+			if (lvm_accepts(frame->env, f, argc)) {
+				lchunk *callee = f->val.context->chunk;
+				long n;
+				if (!memo &&
+					ljit_run(frame->env, callee, &lvm_stack[base], argc, &n)) {
+					lval_del(lvm_collect(base, argc));
+					if (owned) { lval_del(f); }
+					lvm_sp = ret;
+					lvm_push(lval_num(n));
+					return NULL;
+				}
+				// a call that records its result needs a frame of its own
+				if (tail && !memo && frame->scope) {
+					lframe_rebind(frame, callee, base, argc);
+					lvm_sp = ret;
+					if (owned) { lval_del(f); }
+					return frame;
+				}
+				if (lvm_depth >= lvm_max_depth) {
+					lval_del(lvm_collect(base, argc));
+					if (owned) { lval_del(f); }
+					lvm_overflow(ret);
+					return NULL;
+				}
+				lframe *next = lframe_new(frame, callee, frame->env, ret);
+				if (memo) {
+					next->memo = lmemo_retain(memo);
+					next->key = lval_sexpr();
+					for (int i = 0; i < argc; i++) {
+						lval_add(next->key, lval_copy(lvm_stack[base + i]));
+					}
+				}
+				lframe_bind(next, base, argc);
+				lvm_sp = ret;
+				if (owned) { lval_del(f); }
+				return next;
+			}
+			if (!owned) { f = lval_copy(f); }
+			r = lval_call(frame->env, f, lvm_collect(base, argc));
+			lval_del(f);
+			lvm_sp = ret;
+			lvm_push(r);
+			return NULL;
+		}
+		case LVAL_PARTIAL: {
+			// a full application calls the lambda with the arguments given
+			// before spliced in ahead of these
+			lpartial *p = f->val.partial;
+			lval *fn = lpartial_fn(p);
+			int needs = lval_needs(f);
+			if (argc && argc >= needs && (argc == needs || lval_variadic(fn))) {
+				for (int i = 0; i < p->bound; i++) { lvm_push(NULL); }
+				memmove(&lvm_stack[base + p->bound], &lvm_stack[base],
+					sizeof(lval *) * argc);
+				lpartial_args(p, &lvm_stack[base]);
+				lframe *next = lvm_apply(frame, fn, 0, base, p->bound + argc, ret, tail);
+				if (owned) { lval_del(f); }
+				return next;
+			}
+			if (!owned) { f = lval_copy(f); }
+			r = lval_call(frame->env, f, lvm_collect(base, argc));
+			lval_del(f);
+			lvm_sp = ret;
+			lvm_push(r);
+			return NULL;
+		}
+		default:
+			r = lval_err(
+				"S-expression starts with incorrect type. "
+				"Got %s, expected %s or %s.",
+				ltype_name(f->type),
+				ltype_name(LVAL_FUN),
+				ltype_name(LVAL_LAMBDA));
+			if (owned) { lval_del(f); }
+			lval_del(lvm_collect(base, argc));
+			lvm_sp = ret;
+			lvm_push(r);
+			return NULL;
+	}
+}
+
+// binds the argc values on top of the stack to syms, replacing them with
+// () or the first error among them
+static void
+lvm_var(lenv *e, lval *syms, int argc, int global) {
+	lval *a = lvm_collect(lvm_sp - argc, argc);
+	for (int i = 0; i < argc; i++) {
+		if (a->cells[i]->type == LVAL_ERR) {
+			lvm_push(lval_take(a, i));
+			return;
+		}
+	}
+
+	for (int i = 0; i < argc; i++) {
+		if (global) {
+			lenv_def(e, syms->cells[i], a->cells[i]);
+		} else {
+			lenv_put(e, syms->cells[i], a->cells[i]);
+		}
+	}
+	lval_del(a);
+	lvm_push(lval_sexpr());
+}
+
+// integer fast path; returns 0 to defer to the builtin, which also
+// takes over results that overflow and promotes them to double
+static int
+lvm_arith(int op, long a, long b, long *r) {
+	switch (op) {
+		case ARITH_ADD: return !__builtin_add_overflow(a, b, r);
+		case ARITH_SUB: return !__builtin_sub_overflow(a, b, r);
+		case ARITH_MUL: return !__builtin_mul_overflow(a, b, r);
+		case ARITH_DIV:
+			if (b == 0 || (b == -1 && a == LONG_MIN)) { return 0; }
+			*r = a / b;
+			return 1;
+		case ARITH_MOD:
+			if (b == 0) { return 0; }
+			*r = b == -1 ? 0 : a % b;
+			return 1;
+		case ARITH_GT: *r = a > b; return 1;
+		case ARITH_LT: *r = a < b; return 1;
+		case ARITH_GE: *r = a >= b; return 1;
+		case ARITH_LE: *r = a <= b; return 1;
+		case ARITH_EQ: *r = a == b; return 1;
+		case ARITH_NE: *r = a != b; return 1;
+	}
+	return 0;
+}
+
+/*
+ * With LISPY_THREADED every handler ends in its own indirect jump through
+ * the label stored in the code, instead of returning to a shared switch.
+ */
+#ifdef LISPY_THREADED
+static void **lvm_labels;
+#define VM_DISPATCH VM_NEXT;
+#define VM_CASE(op) L_##op:
+#define VM_NEXT goto *(void *) *ip++
+#else
+#define VM_DISPATCH for (;;) switch (*ip++)
+#define VM_CASE(op) case op:
+#define VM_NEXT continue
+#endif
+
+// switches the loop over to a frame returned by lvm_apply
+#define VM_ENTER(next) \
+	if (next) { frame = next; c = frame->chunk; ip = frame->ip; }
+
+// checks that a fused instruction's operator still names its builtin
+#define VM_GUARD(arith, k, cache) \
+	lval *f = lvm_lookup(frame->env, c->consts[k]->val.sym, &c->caches[cache]); \
+	int guard = f && f->type == LVAL_FUN && f->val.builtin == arith_builtins[arith];
+
+static lval *
+lvm_exec(lframe *frame) {
+#ifdef LISPY_THREADED
+	static void *labels[OP_COUNT] = {
+		&&L_OP_CONST, &&L_OP_LOCAL, &&L_OP_LOOKUP, &&L_OP_CALL, &&L_OP_TCALL,
+		&&L_OP_CALLSYM, &&L_OP_TCALLSYM, &&L_OP_ARITH, &&L_OP_DEF, &&L_OP_PUT,
+		&&L_OP_GUARD, &&L_OP_IF, &&L_OP_JUMP, &&L_OP_POP,
+		&&L_OP_RETURN, &&L_OP_ARITH_LL, &&L_OP_ARITH_LK, &&L_OP_IF_LL,
+		&&L_OP_IF_LK, &&L_OP_RECUR
+	};
+	// called without a frame to hand the label table to lvm_thread
+	if (!frame) {
+		lvm_labels = labels;
+		return NULL;
+	}
+#endif
+
+	if (!lvm_nest()) {
+		lframe_leave(frame);
+		return lval_err("stack depth exceeded");
+	}
+
+	lframe *entry = frame;
+	lchunk *c = frame->chunk;
+	intptr_t *ip = frame->ip;
+	lframe *next;
+	int tail;
+	long r;
+
+	VM_DISPATCH {
+		VM_CASE(OP_CONST) {
+			lvm_push(lval_copy(c->consts[*ip++]));
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_LOCAL) {
+			lvm_push(lval_copy(frame->locals.vals[*ip++]));
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_LOOKUP) {
+			char *sym = c->consts[ip[0]]->val.sym;
+			lval *v = lvm_lookup(frame->env, sym, &c->caches[ip[1]]);
+			ip += 2;
+			lvm_push(v ? lval_copy(v)
+				: lval_err("Unbound symbol '%s',", sym));
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_TCALL) {
+			tail = 1;
+			goto call;
+		}
+
+		VM_CASE(OP_CALL) {
+			tail = 0;
+		call:;
+			int argc = *ip++;
+			int base = lvm_sp - argc;
+			lval *f = lvm_stack[base - 1];
+			if (f->type == LVAL_ERR) {
+				lval_del(lvm_collect(base, argc));
+				VM_NEXT;
+			}
+			frame->ip = ip;
+			next = lvm_apply(frame, f, 1, base, argc, base - 1, tail);
+			VM_ENTER(next);
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_TCALLSYM) {
+			tail = 1;
+			goto callsym;
+		}
+
+		VM_CASE(OP_CALLSYM) {
+			tail = 0;
+		callsym:;
+			char *sym = c->consts[ip[0]]->val.sym;
+			lval *f = lvm_lookup(frame->env, sym, &c->caches[ip[1]]);
+			int argc = ip[2];
+			int base = lvm_sp - argc;
+			ip += 3;
+
+			if (!f) {
+				lval_del(lvm_collect(base, argc));
+				lvm_push(lval_err("Unbound symbol '%s',", sym));
+				VM_NEXT;
+			}
+			frame->ip = ip;
+			next = lvm_apply(frame, f, 0, base, argc, base, tail);
+			VM_ENTER(next);
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_ARITH) {
+			int arith = ip[0];
+			char *sym = c->consts[ip[1]]->val.sym;
+			lval *f = lvm_lookup(frame->env, sym, &c->caches[ip[2]]);
+			int keep = ip[3] >= 0;
+			int base = lvm_sp - 2;
+			ip += 4;
+
+			// the result reuses an operand on the heap if there is one
+			lval *x = lvm_stack[base];
+			lval *y = lvm_stack[base + 1];
+			if (f && f->type == LVAL_FUN && f->val.builtin == arith_builtins[arith] &&
+				x->type == LVAL_NUM && y->type == LVAL_NUM &&
+				lvm_arith(arith, x->val.num, y->val.num, &r)) {
+				if (!LFRAME_TEMP(frame, x)) {
+					x->val.num = r;
+					if (!LFRAME_TEMP(frame, y)) { lval_del(y); }
+				} else if (!LFRAME_TEMP(frame, y)) {
+					y->val.num = r;
+					lvm_stack[base] = y;
+				} else if (keep) {
+					x->val.num = r;
+				} else {
+					lvm_stack[base] = lval_num(r);
+				}
+				lvm_sp--;
+				VM_NEXT;
+			}
+
+			lframe_detach(frame, base, 2);
+			if (!f) {
+				lval_del(lvm_collect(base, 2));
+				lvm_push(lval_err("Unbound symbol '%s',", sym));
+				VM_NEXT;
+			}
+
+			frame->ip = ip;
+			next = lvm_apply(frame, f, 0, base, 2, base, 0);
+			VM_ENTER(next);
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_DEF) {
+			lvm_var(frame->env, c->consts[ip[0]], ip[1], 1);
+			ip += 2;
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_PUT) {
+			lvm_var(frame->env, c->consts[ip[0]], ip[1], 0);
+			ip += 2;
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_GUARD) {
+			char *sym = c->consts[ip[0]]->val.sym;
+			unsigned v = lvm_version(frame->env, sym, &c->caches[ip[1]]);
+			ip = v && v == (unsigned) ip[2] ? ip + 4 : c->exec + ip[3];
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_IF) {
+			lval *x = lvm_stack[lvm_sp - 1];
+			if (x->type == LVAL_ERR) {
+				ip = c->exec + ip[1];
+				VM_NEXT;
+			}
+			if (x->type != LVAL_NUM) {
+				lvm_stack[lvm_sp - 1] = lval_err(
+					"function %s passed incorrect type for argument %i. "
+					"Got %s, expected %s.",
+					"if", 0, ltype_name(x->type), ltype_name(LVAL_NUM));
+				lval_del(x);
+				ip = c->exec + ip[1];
+				VM_NEXT;
+			}
+			lvm_sp--;
+			ip = x->val.num ? ip + 2 : c->exec + ip[0];
+			if (!LFRAME_TEMP(frame, x)) { lval_del(x); }
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_JUMP) {
+			ip = c->exec + *ip;
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_POP) {
+			lval_del(lvm_stack[--lvm_sp]);
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_RETURN) {
+			lval *v = lvm_stack[--lvm_sp];
+			if (frame->memo) { lframe_remember(frame, v); }
+			int ret = frame->ret;
+			int done = frame == entry;
+			frame = lframe_leave(frame);
+			lvm_sp = ret;
+			if (done) {
+				lvm_nesting--;
+				return v;
+			}
+			lvm_push(v);
+			c = frame->chunk;
+			ip = frame->ip;
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_ARITH_LL) {
+			VM_GUARD(ip[0], ip[3], ip[4]);
+			lval *x = frame->locals.vals[ip[1]];
+			lval *y = frame->locals.vals[ip[2]];
+			if (guard && x->type == LVAL_NUM && y->type == LVAL_NUM &&
+				lvm_arith(ip[0], x->val.num, y->val.num, &r)) {
+				lvm_push(lframe_number(frame, ip[6], r));
+				ip = c->exec + ip[5];
+				VM_NEXT;
+			}
+			ip += 7;
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_ARITH_LK) {
+			VM_GUARD(ip[0], ip[3], ip[4]);
+			lval *x = frame->locals.vals[ip[1]];
+			if (guard && x->type == LVAL_NUM &&
+				lvm_arith(ip[0], x->val.num, c->consts[ip[2]]->val.num, &r)) {
+				lvm_push(lframe_number(frame, ip[6], r));
+				ip = c->exec + ip[5];
+				VM_NEXT;
+			}
+			ip += 7;
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_IF_LL) {
+			VM_GUARD(ip[0], ip[3], ip[4]);
+			lval *x = frame->locals.vals[ip[1]];
+			lval *y = frame->locals.vals[ip[2]];
+			if (guard && x->type == LVAL_NUM && y->type == LVAL_NUM &&
+				lvm_arith(ip[0], x->val.num, y->val.num, &r)) {
+				ip = c->exec + (r ? ip[5] : ip[6]);
+				VM_NEXT;
+			}
+			ip += 7;
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_IF_LK) {
+			VM_GUARD(ip[0], ip[3], ip[4]);
+			lval *x = frame->locals.vals[ip[1]];
+			if (guard && x->type == LVAL_NUM &&
+				lvm_arith(ip[0], x->val.num, c->consts[ip[2]]->val.num, &r)) {
+				ip = c->exec + (r ? ip[5] : ip[6]);
+				VM_NEXT;
+			}
+			ip += 7;
+			VM_NEXT;
+		}
+
+		VM_CASE(OP_RECUR) {
+			int argc = ip[0];
+			int base = lvm_sp - argc;
+			tail = ip[1];
+			ip += 2;
+
+			int err = -1;
+			for (int i = 0; i < argc && err < 0; i++) {
+				if (lvm_stack[base + i]->type == LVAL_ERR) { err = i; }
+			}
+
+			// numbers the arguments left in scratch overwrite the old
+			// values in place, so counting loops allocate nothing; the
+			// variables come first in the scope, ahead of anything '=' or
+			// a tail call added
+			if (tail && err < 0 && frame->scope == c) {
+				for (int i = 0; i < argc; i++) {
+					lval *x = lvm_stack[base + i];
+					lval *old = frame->locals.vals[i];
+					if (LFRAME_TEMP(frame, x)) {
+						if (old->type == LVAL_NUM) {
+							old->val.num = x->val.num;
+							continue;
+						}
+						x = lval_num(x->val.num);
+					}
+					lval_del(old);
+					frame->locals.vals[i] = x;
+				}
+				lvm_sp = base;
+				ip = c->exec;
+				VM_NEXT;
+			}
+
+			lframe_detach(frame, base, argc);
+			if (err >= 0) {
+				lvm_push(lval_take(lvm_collect(base, argc), err));
+				VM_NEXT;
+			}
+			if (tail) {
+				lframe_rebind(frame, c, base, argc);
+				lvm_sp = base;
+				ip = frame->ip;
+				VM_NEXT;
+			}
+			if (lvm_depth >= lvm_max_depth) {
+				lval_del(lvm_collect(base, argc));
+				lvm_overflow(base);
+				VM_NEXT;
+			}
+			frame->ip = ip;
+			next = lframe_new(frame, c, frame->env, base);
+			lframe_bind(next, base, argc);
+			lvm_sp = base;
+			VM_ENTER(next);
+			VM_NEXT;
+		}
+	}
+#ifndef LISPY_THREADED
+	return NULL;
+#endif
+}
+
+// lays out a chunk's code in the form lvm_exec dispatches on
+void
+lvm_thread(lchunk *c) {
+#ifdef LISPY_THREADED
+	if (!lvm_labels) { lvm_exec(NULL); }
+#endif
+	c->exec = malloc(sizeof(intptr_t) * c->count);
+	for (int i = 0; i < c->count; i += 1 + lop_operands[c->code[i]]) {
+#ifdef LISPY_THREADED
+		c->exec[i] = (intptr_t) lvm_labels[c->code[i]];
+#else
+		c->exec[i] = c->code[i];
+#endif
+		for (int j = 1; j <= lop_operands[c->code[i]]; j++) {
+			c->exec[i + j] = c->code[i + j];
+		}
+	}
+}
+
+void
+lvm_report(void) {
+	fflush(stdout);
+	fprintf(stderr, "alloc: %li values allocated, %li temporaries kept in "
+		"frame scratch\n", lval_allocs, lvm_temps);
+}
+
+// calls a lambda accepted by lvm_accepts, consuming the argument list
+lval *
+lvm_call(lenv *e, lval *f, lval *a) {
+	long n;
+	if (ljit_run(e, f->val.context->chunk, a->cells, a->count, &n)) {
+		lval_del(a);
+		return lval_num(n);
+	}
+
+	int base = lvm_sp;
+	int argc = a->count;
+	for (int i = 0; i < argc; i++) {
+		lvm_push(a->cells[i]);
+	}
+	a->count = 0;
+	lval_del(a);
+
+	lframe *frame = lframe_new(NULL, f->val.context->chunk, e, base);
+	lframe_bind(frame, base, argc);
+	lvm_sp = base;
+	return lvm_exec(frame);
+}
+
+// compiles and runs a top-level form, consuming it
+lval *
+lvm_eval(lenv *e, lval *v) {
+	lchunk *c = lcompile_expr(e, v);
+	lval_del(v);
+
+	lframe *frame = lframe_new(NULL, c, e, lvm_sp);
+	lchunk_release(c);
+	return lvm_exec(frame);
+}
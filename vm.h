@@ -0,0 +1,164 @@
+#ifndef __VM_H
+
+/*
+ * Bytecode for the stack VM. Lambda bodies are compiled on their first
+ * call and top-level forms just before they run; the tree-walker in
+ * lispy.c stays in charge of anything the compiler cannot see ahead of
+ * time, such as `eval` of Q-expressions built at runtime.
+ *
+ * Code is a flat array of ints: an opcode followed by its operands.
+ * Before it runs, each chunk is threaded into `exec`, where the opcode
+ * words become label addresses when built with LISPY_THREADED.
+ */
+enum {
+	OP_CONST,    // k          push a copy of consts[k]
+	OP_LOCAL,    // i          push a copy of local slot i
+	OP_LOOKUP,   // k c        push a copy of symbol consts[k], cache c
+	OP_CALL,     // n          call the value below n arguments
+	OP_TCALL,    // n          OP_CALL in tail position
+	OP_CALLSYM,  // k c n      call the function bound to consts[k]
+	OP_TCALLSYM, // k c n      OP_CALLSYM in tail position
+	OP_ARITH,    // a k c s    binary arithmetic a, guarded by consts[k]
+	OP_DEF,      // k n        'def' the n values on top to the symbols consts[k]
+	OP_PUT,      // k n        OP_DEF for '='
+	OP_GUARD,    // k c v else jump unless consts[k] names the global stamped v
+	OP_IF,       // else end   test the condition on top of the stack
+	OP_JUMP,     // addr
+	OP_POP,
+	OP_RETURN,
+
+	/*
+	 * Superinstructions for arithmetic on a local and a local or integer
+	 * literal. Each is followed by the unfused sequence it replaces,
+	 * which runs when the guard or the operand types do not hold.
+	 */
+	OP_ARITH_LL, // a i j k c next s
+	OP_ARITH_LK, // a i k' k c next s
+	OP_IF_LL,    // a i j k c then else
+	OP_IF_LK,    // a i k' k c then else
+
+	/*
+	 * 'recur' in the body of a 'loop', which runs as a lambda of its own:
+	 * in tail position the n values rebind its variables in place and the
+	 * body starts over, elsewhere they are a new call to it.
+	 */
+	OP_RECUR,    // n tail
+	OP_COUNT
+};
+
+extern const int lop_operands[OP_COUNT];
+
+/*
+ * Results of arithmetic that only an inline OP_ARITH or OP_IF reads never
+ * outlive that instruction, so the compiler gives them a scratch cell s
+ * in the frame instead of allocating them; s is -1 for results that may
+ * escape. A result in scratch is copied to the heap before the operation
+ * falls back to calling its operator.
+ */
+
+// binary builtins the VM evaluates inline when both operands are numbers
+enum { ARITH_ADD, ARITH_SUB, ARITH_MUL, ARITH_DIV, ARITH_MOD,
+	ARITH_GT, ARITH_LT, ARITH_GE, ARITH_LE, ARITH_EQ, ARITH_NE, ARITH_COUNT };
+
+extern lbuiltin arith_builtins[ARITH_COUNT];
+
+// remembers where a global was last found so repeat lookups skip the scan
+typedef struct lcache {
+	lenv *env;
+	int slot;
+} lcache;
+
+typedef struct ljit ljit;
+
+struct lchunk {
+	int refs;
+
+	// set for lambda bodies, which run in a scope of their own;
+	// locals are the fixed formals, then the '&' list when variadic
+	int lambda;
+	// set for 'loop' bodies, which 'recur' restarts
+	int loop;
+	int nformals;
+	int variadic;
+	int nlocals;
+	char **locals;
+
+	int count;
+	int cap;
+	int *code;
+	intptr_t *exec;
+
+	int nconsts;
+	lval **consts;
+
+	int ncaches;
+	lcache *caches;
+
+	// scratch cells a frame running this chunk needs
+	int nscratch;
+
+	// calls counted towards the JIT threshold, and the native code
+	int calls;
+	ljit *jit;
+};
+
+lchunk *lchunk_retain(lchunk *);
+void lchunk_release(lchunk *);
+int lchunk_local(lchunk *, char *);
+
+lchunk *lcompile_lambda(lenv *, lval *, lval *);
+lchunk *lcompile_loop(lenv *, lval *, lval *);
+lchunk *lcompile_expr(lenv *, lval *);
+int lcompile_arith(char *);
+
+// constant folding, which the compiler guards on the operators it used
+#define LOPT_DEPS 8
+typedef struct lopt_deps {
+	int count;
+	char *syms[LOPT_DEPS];
+	// set once an operator did not fit
+	int full;
+} lopt_deps;
+
+extern int lopt_dump;
+lval *lopt_value(lenv *, lval *, lopt_deps *);
+void lopt_forget(void);
+
+/*
+ * Native code for hot lambdas, from the JIT or from lispyc. It takes the
+ * arguments at descending addresses from the pointer it is given, and
+ * returns 1 with the result in *out or 0 to bail out; ljit_depth counts
+ * its activations up to LJIT_DEPTH. Without LISPY_JIT only code lispyc
+ * translated runs.
+ */
+#define LJIT_DEPTH 10000
+typedef int (*ljit_fn)(long *, long *);
+extern int ljit_stats;
+extern long ljit_depth;
+int ljit_run(lenv *, lchunk *, lval **, int, long *);
+int ljit_plan(lenv *, lchunk *, char *);
+void ljit_adopt(lenv *, char *, const int *, int, lval *, ljit_fn);
+void ljit_release(ljit *);
+void ljit_report(void);
+
+// frames in use, and entries into the evaluator nested on the C stack
+#define LVM_MAX_DEPTH 100000
+#define LVM_NESTING 10000
+extern int lvm_max_depth;
+extern int lvm_depth;
+extern int lvm_nesting;
+int lvm_nest(void);
+
+// values allocated, and results kept in scratch instead, for --alloc-stats
+extern int lvm_stats;
+extern long lvm_temps;
+void lvm_report(void);
+
+void lvm_thread(lchunk *);
+int lvm_accepts(lenv *, lval *, int);
+unsigned lvm_version(lenv *, char *, lcache *);
+lval *lvm_call(lenv *, lval *, lval *);
+lval *lvm_eval(lenv *, lval *);
+
+#define __VM_H 1
+#endif